@@ -0,0 +1,51 @@
+#include <Iyp/WaitFreeRingBufferUtilities/async-logger.inl>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace
+{
+using AsyncLoggerType = Iyp::WaitFreeRingBufferUtilities::AsyncLogger<1 << 16>;
+
+// Cost of one log call on the calling thread, the formatting and writing happen on the logger's own thread.
+void async_logger_benchmark(benchmark::State &state)
+{
+    std::FILE *const file = std::fopen("/dev/null", "w");
+    std::size_t dropped_count = 0;
+    {
+        AsyncLoggerType logger(file);
+        std::uint64_t i = 0;
+        for (auto _ : state)
+        {
+            logger.log("order {} filled {} at {} on {}", i, std::int64_t(100), 1.25, "venue");
+            i++;
+        }
+        dropped_count = logger.dropped_count();
+    }
+    std::fclose(file);
+
+    state.counters["dropped"] = static_cast<double>(dropped_count);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Formatting and writing on the calling thread, for comparison.
+void fprintf_benchmark(benchmark::State &state)
+{
+    std::FILE *const file = std::fopen("/dev/null", "w");
+    std::uint64_t i = 0;
+    for (auto _ : state)
+    {
+        std::fprintf(file, "order %llu filled %lld at %g on %s\n", static_cast<unsigned long long>(i), 100LL, 1.25, "venue");
+        i++;
+    }
+    std::fclose(file);
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(async_logger_benchmark);
+BENCHMARK(fprintf_benchmark);
+} // namespace
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <Iyp/WaitFreeRingBufferUtilities/wait-strategy.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/details/thread-affinity.inl>
+
+#include <cstddef>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+
+enum class ThreadType
+{
+    PRODUCER,
+    CONSUMER,
+};
+
+// Counters for the iterations of a Thread, opened from the thread itself and only counting while it pushes or pops.
+struct NoThreadCounters
+{
+    void open()
+    {
+    }
+
+    void start()
+    {
+    }
+
+    void stop()
+    {
+    }
+};
+
+template <typename RingType,
+          typename WaitStrategy = Iyp::WaitFreeRingBufferUtilities::BusySpinWait,
+          typename Counters = NoThreadCounters>
+class Thread
+{
+    enum : std::uint8_t
+    {
+        START_ITERATION,
+        ENDED_ITERATION,
+    };
+
+    enum : std::uint8_t
+    {
+        STARTING,
+        STARTED,
+        PINNING_FAILED,
+    };
+
+    RingType &ring;
+    std::atomic<std::uint8_t> signal;
+    std::atomic<std::uint8_t> startup;
+    std::atomic<bool> should_stop;
+    std::size_t number_of_processed_elements_per_iteration;
+    Counters counters;
+    std::thread thread;
+
+    void wait_until_started() const
+    {
+        while (startup == STARTING)
+            std::this_thread::yield();
+    }
+
+    void producer_thread()
+    {
+        while (!should_stop)
+            if (signal == START_ITERATION)
+            {
+                counters.start();
+                for (std::size_t i = 0; i < number_of_processed_elements_per_iteration; i++)
+                    Iyp::WaitFreeRingBufferUtilities::push_wait<WaitStrategy>(ring, i);
+                counters.stop();
+
+                signal = ENDED_ITERATION;
+            }
+    }
+
+    void consumer_thread()
+    {
+        while (!should_stop)
+            if (signal == START_ITERATION)
+            {
+                counters.start();
+                for (std::size_t i = 0; i < number_of_processed_elements_per_iteration; i++)
+                    Iyp::WaitFreeRingBufferUtilities::pop_wait<WaitStrategy>(ring);
+                counters.stop();
+
+                signal = ENDED_ITERATION;
+            }
+    }
+
+public:
+    // The thread is pinned to cpu unless it is negative.
+    Thread(RingType &i_ring,
+           const ThreadType thread_type,
+           const std::size_t i_number_of_processed_elements_per_iteration,
+           const int cpu = -1)
+        : ring(i_ring),
+          signal(ENDED_ITERATION),
+          startup(STARTING),
+          should_stop(false),
+          number_of_processed_elements_per_iteration(i_number_of_processed_elements_per_iteration),
+          thread([this, thread_type, cpu]() {
+              const bool is_pinned = cpu < 0 || Iyp::WaitFreeRingBufferUtilities::Details::pin_current_thread_to_cpu(cpu);
+              counters.open();
+              startup = is_pinned ? STARTED : PINNING_FAILED;
+              thread_type == ThreadType::PRODUCER ? producer_thread() : consumer_thread();
+          })
+    {
+    }
+
+    // Waits until the thread has tried to pin itself.
+    bool has_pinning_failed() const
+    {
+        wait_until_started();
+        return startup == PINNING_FAILED;
+    }
+
+    // Should only be read between iterations.
+    const Counters &get_counters() const
+    {
+        wait_until_started();
+        return counters;
+    }
+
+    void run_an_iteration()
+    {
+        signal = START_ITERATION;
+    }
+
+    template <typename IterationWaitStrategy = WaitStrategy>
+    void wait_for_iteration_to_end()
+    {
+        IterationWaitStrategy wait_strategy;
+        while (signal != ENDED_ITERATION)
+            wait_strategy.wait();
+    }
+
+    ~Thread()
+    {
+        should_stop = true;
+        while (!thread.joinable())
+        {
+        }
+        thread.join();
+    }
+};
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <Iyp/WaitFreeRingBufferUtilities/optional-type.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl>
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename ElementType, std::size_t Count>
+class MutexDequeQueue
+{
+    std::mutex mutex;
+    std::deque<ElementType> elements;
+
+public:
+    template <typename... Args>
+    bool push(Args &&...args)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (elements.size() >= Count)
+            return false;
+
+        elements.emplace_back(std::forward<Args>(args)...);
+        return true;
+    }
+
+    Iyp::WaitFreeRingBufferUtilities::OptionalType<ElementType> pop()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (elements.empty())
+            return Iyp::WaitFreeRingBufferUtilities::OptionalType<ElementType>{};
+
+        Iyp::WaitFreeRingBufferUtilities::OptionalType<ElementType> result{std::move(elements.front())};
+        elements.pop_front();
+        return result;
+    }
+};
+
+// Dmitry Vyukov's bounded MPMC queue, as published.
+template <typename ElementType, std::size_t Count>
+class VyukovBoundedQueue
+{
+    static_assert(Count >= 2 && !((Count - 1) & Count), "Count should be a power of two.");
+
+    enum : std::size_t
+    {
+        COUNT_MASK = Count - 1,
+    };
+
+    struct Cell
+    {
+        std::atomic_size_t sequence;
+        typename std::aligned_storage<sizeof(ElementType), alignof(ElementType)>::type storage;
+    };
+
+    Iyp::WaitFreeRingBufferUtilities::Details::CacheAlignedAndPaddedObject<std::atomic_size_t> enqueue_position{std::size_t(0)};
+    Iyp::WaitFreeRingBufferUtilities::Details::CacheAlignedAndPaddedObject<std::atomic_size_t> dequeue_position{std::size_t(0)};
+    Cell cells[Count];
+
+public:
+    VyukovBoundedQueue()
+    {
+        for (std::size_t i = 0; i < Count; i++)
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    VyukovBoundedQueue(const VyukovBoundedQueue &) = delete;
+    VyukovBoundedQueue &operator=(const VyukovBoundedQueue &) = delete;
+
+    template <typename... Args>
+    bool push(Args &&...args)
+    {
+        std::size_t position = enqueue_position.load(std::memory_order_relaxed);
+        Cell *cell;
+        while (true)
+        {
+            cell = &cells[position & COUNT_MASK];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+            if (difference == 0)
+            {
+                if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+                return false;
+            else
+                position = enqueue_position.load(std::memory_order_relaxed);
+        }
+
+        new (&cell->storage) ElementType(std::forward<Args>(args)...);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    Iyp::WaitFreeRingBufferUtilities::OptionalType<ElementType> pop()
+    {
+        std::size_t position = dequeue_position.load(std::memory_order_relaxed);
+        Cell *cell;
+        while (true)
+        {
+            cell = &cells[position & COUNT_MASK];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+            if (difference == 0)
+            {
+                if (dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+                return Iyp::WaitFreeRingBufferUtilities::OptionalType<ElementType>{};
+            else
+                position = dequeue_position.load(std::memory_order_relaxed);
+        }
+
+        ElementType &element = *reinterpret_cast<ElementType *>(&cell->storage);
+        Iyp::WaitFreeRingBufferUtilities::OptionalType<ElementType> result{std::move(element)};
+        element.~ElementType();
+        cell->sequence.store(position + COUNT_MASK + 1, std::memory_order_release);
+        return result;
+    }
+
+    ~VyukovBoundedQueue()
+    {
+        while (pop())
+        {
+        }
+    }
+};
@@ -0,0 +1,54 @@
+#include <Iyp/WaitFreeRingBufferUtilities/duplex-channel.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/details/aligned-allocation.inl>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t ChannelDepth = 256;
+
+using DuplexChannelType = Iyp::WaitFreeRingBufferUtilities::DuplexChannel<std::uint64_t, std::uint64_t, ChannelDepth>;
+
+// Each iteration submits a batch of range(0) requests and waits until all of them are reaped, so with a batch of one the time per
+// iteration is the round trip latency.
+void round_trip_benchmark(benchmark::State &state)
+{
+    const auto batch_size = static_cast<std::size_t>(state.range(0));
+    const auto channel = Iyp::WaitFreeRingBufferUtilities::Details::make_aligned_unique<DuplexChannelType>();
+    std::atomic_bool should_stop{false};
+
+    std::thread server([&channel, &should_stop]() {
+        while (!should_stop.load(std::memory_order_relaxed))
+            channel->serve([](std::uint64_t &request) { return request + 1; });
+    });
+
+    std::vector<std::uint64_t> requests(batch_size);
+    for (std::size_t i = 0; i < batch_size; i++)
+        requests[i] = i;
+    std::vector<std::uint64_t> correlation_ids(batch_size);
+
+    std::uint64_t checksum = 0;
+    for (auto _ : state)
+    {
+        channel->submit_batch(requests.data(), batch_size, correlation_ids.data());
+
+        std::size_t reaped_count = 0;
+        while (reaped_count < batch_size)
+            reaped_count += channel->reap([&checksum](std::uint64_t, std::uint64_t &response) { checksum += response; });
+    }
+
+    should_stop = true;
+    server.join();
+
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
+BENCHMARK(round_trip_benchmark)->Arg(1)->Arg(8)->Arg(32)->Arg(ChannelDepth)->UseRealTime();
+} // namespace
@@ -0,0 +1,92 @@
+#include "payloads.inl"
+
+#include <Iyp/WaitFreeRingBufferUtilities/journal-ring-buffer.inl>
+
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t JournalSize = 4096;
+constexpr std::size_t NumberOfProcessedElementsPerIteration = JournalSize;
+
+using JournalRingBufferType = Iyp::WaitFreeRingBufferUtilities::JournalRingBuffer<Payload<64>, JournalSize>;
+
+// The journal lives in the working directory rather than /tmp, which is often a tmpfs where msync costs nothing.
+void journal_throughput_benchmark(benchmark::State &state)
+{
+    using Iyp::WaitFreeRingBufferUtilities::JournalFlushPolicy;
+    const auto flush_policy = static_cast<JournalFlushPolicy>(state.range(0));
+    const auto batch_size = static_cast<std::size_t>(state.range(1));
+
+    char path[] = "ring-benchmark-journal-XXXXXX";
+    const int file_descriptor = ::mkstemp(path);
+    if (file_descriptor < 0)
+    {
+        state.SkipWithError("Could not create the journal file.");
+        return;
+    }
+    ::close(file_descriptor);
+
+    {
+        JournalRingBufferType journal(path, flush_policy);
+        if (!journal.is_open())
+            state.SkipWithError("Could not map the journal file.");
+
+        std::vector<Payload<64>> batch;
+        for (std::size_t i = 0; i < batch_size; i++)
+            batch.emplace_back(i);
+        for (auto _ : state)
+        {
+            if (!journal.is_open())
+                break;
+
+            std::thread consumer([&journal]() {
+                for (std::size_t i = 0; i < NumberOfProcessedElementsPerIteration;)
+                    if (auto element = journal.pop())
+                    {
+                        benchmark::DoNotOptimize(*element);
+                        i++;
+                    }
+            });
+
+            for (std::size_t i = 0; i < NumberOfProcessedElementsPerIteration;)
+                i += journal.push_batch(batch.data(), std::min(batch_size, NumberOfProcessedElementsPerIteration - i));
+
+            consumer.join();
+        }
+    }
+    std::remove(path);
+
+    state.SetItemsProcessed(state.iterations() * NumberOfProcessedElementsPerIteration);
+}
+
+bool register_journal_benchmarks()
+{
+    using Iyp::WaitFreeRingBufferUtilities::JournalFlushPolicy;
+    const std::pair<JournalFlushPolicy, const char *> flush_policies[] = {{JournalFlushPolicy::NONE, "None"},
+                                                                          {JournalFlushPolicy::PERIODIC, "Periodic"},
+                                                                          {JournalFlushPolicy::PER_BATCH, "PerBatch"}};
+    for (const auto &flush_policy : flush_policies)
+    {
+        auto *const benchmark = benchmark::RegisterBenchmark((std::string("journal_throughput_benchmark/") + flush_policy.second).c_str(),
+                                                             journal_throughput_benchmark);
+        benchmark->ArgNames({"Flush Policy", "Batch Size"})->UseRealTime();
+        for (const int batch_size : {1, 16, 256})
+            benchmark->Args({static_cast<int>(flush_policy.first), batch_size});
+    }
+    return true;
+}
+
+const bool are_journal_benchmarks_registered = register_journal_benchmarks();
+} // namespace
@@ -1,15 +1,21 @@
+#include "benchmark-thread.inl"
+#include "perf-counters.inl"
+
 #include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
 
 #include <benchmark/benchmark.h>
 
+#ifdef __unix__
+#include <sys/resource.h>
+#endif
+
 #include <cstddef>
 #include <cstdlib>
 #include <ctime>
 #include <list>
-#include <atomic>
-#include <thread>
 #include <cstdint>
 #include <utility>
+#include <chrono>
 
 static constexpr std::size_t RingSize = 1024;
 
@@ -33,104 +39,94 @@ using ScspRingBufferType = Iyp::WaitFreeRingBufferUtilities::RingBuffer<Iyp::Wai
                                                                         std::size_t,
                                                                         RingSize>;
 
-enum class ThreadType
-{
-    PRODUCER,
-    CONSUMER,
-};
+using OrderedMcmpRingBufferType = Iyp::WaitFreeRingBufferUtilities::RingBuffer<Iyp::WaitFreeRingBufferUtilities::OrderedMultiProducer,
+                                                                               Iyp::WaitFreeRingBufferUtilities::OrderedMultiConsumer,
+                                                                               std::size_t,
+                                                                               RingSize>;
+
+// Runs the single producer and single consumer protocols as long as no second thread attaches to a side.
+using AdaptiveRingBufferType = Iyp::WaitFreeRingBufferUtilities::RingBuffer<Iyp::WaitFreeRingBufferUtilities::AdaptiveProducer,
+                                                                            Iyp::WaitFreeRingBufferUtilities::AdaptiveConsumer,
+                                                                            std::size_t,
+                                                                            RingSize>;
 
 template <typename RingType>
-class Thread
+void throughput_benchmark(benchmark::State &state)
 {
-    enum : std::uint8_t
-    {
-        START_ITERATION,
-        ENDED_ITERATION,
-    };
+    constexpr std::size_t NumberOfProcessedElementsPerIteration = RingSize * 8;
+    RingType ring;
+    for (std::size_t i = 0; i < RingSize / 2; i++)
+        ring.push(i);
 
-    RingType &ring;
-    std::atomic<std::uint8_t> signal;
-    std::atomic<bool> should_stop;
-    std::size_t number_of_processed_elements_per_iteration;
-    std::thread thread;
+    const auto producer_count = static_cast<std::size_t>(state.range(0));
+    const auto consumer_count = static_cast<std::size_t>(state.range(1));
+    std::list<Thread<RingType, Iyp::WaitFreeRingBufferUtilities::BusySpinWait, PerfCounters>> threads;
 
-    void producer_thread()
-    {
-        while (!should_stop)
-            if (signal == START_ITERATION)
-            {
-                for (std::size_t i = 0; i < number_of_processed_elements_per_iteration; i++)
-                    while (!ring.push(i))
-                    {
-                    }
-
-                signal = ENDED_ITERATION;
-            }
-    }
+    for (std::size_t i = 0; i < producer_count; i++)
+        threads.emplace_back(ring, ThreadType::PRODUCER, NumberOfProcessedElementsPerIteration * consumer_count);
 
-    void consumer_thread()
-    {
-        while (!should_stop)
-            if (signal == START_ITERATION)
-            {
-                for (std::size_t i = 0; i < number_of_processed_elements_per_iteration; i++)
-                    while (!ring.pop())
-                    {
-                    }
-
-                signal = ENDED_ITERATION;
-            }
-    }
+    for (std::size_t i = 0; i < consumer_count; i++)
+        threads.emplace_back(ring, ThreadType::CONSUMER, NumberOfProcessedElementsPerIteration * producer_count);
 
-public:
-    Thread(RingType &i_ring,
-           const ThreadType thread_type,
-           const std::size_t i_number_of_processed_elements_per_iteration)
-        : ring(i_ring),
-          signal(ENDED_ITERATION),
-          should_stop(false),
-          number_of_processed_elements_per_iteration(i_number_of_processed_elements_per_iteration),
-          thread([this, thread_type]() { thread_type == ThreadType::PRODUCER ? producer_thread() : consumer_thread(); })
+    for (auto _ : state)
     {
+        for (auto &thread : threads)
+            thread.run_an_iteration();
+        for (auto &thread : threads)
+            thread.wait_for_iteration_to_end();
     }
 
-    void run_an_iteration()
-    {
-        signal = START_ITERATION;
-    }
+    // Workers only count their push/pop loops. One operation is a push and its pop.
+    PerfCounterTotals perf_counter_totals;
+    for (const auto &thread : threads)
+        thread.get_counters().add_to(perf_counter_totals);
+    perf_counter_totals.report(state, double(state.iterations()) * NumberOfProcessedElementsPerIteration * producer_count * consumer_count);
+    state.SetComplexityN((state.range(0) + state.range(1)) * NumberOfProcessedElementsPerIteration * state.range(0) * state.range(1));
+}
 
-    void wait_for_iteration_to_end()
-    {
-        while (signal != ENDED_ITERATION)
-        {
-        }
-    }
+BENCHMARK_TEMPLATE(throughput_benchmark, ScmpRingBufferType)->ArgsProduct({{1, 2, 3, 4, 5, 6, 7}, {1}})->ArgNames({"Producer Count", "Consumer Count"})->Complexity();
+BENCHMARK_TEMPLATE(throughput_benchmark, McspRingBufferType)->ArgsProduct({{1}, {1, 2, 3, 4, 5, 6, 7}})->ArgNames({"Producer Count", "Consumer Count"})->Complexity();
+BENCHMARK_TEMPLATE(throughput_benchmark, McmpRingBufferType)->ArgsProduct({{1, 2, 3, 4}, {1, 2, 3, 4}})->ArgNames({"Producer Count", "Consumer Count"})->Complexity();
+BENCHMARK_TEMPLATE(throughput_benchmark, OrderedMcmpRingBufferType)->ArgsProduct({{1, 2, 3, 4}, {1, 2, 3, 4}})->ArgNames({"Producer Count", "Consumer Count"})->Complexity();
+BENCHMARK_TEMPLATE(throughput_benchmark, ScspRingBufferType)->ArgsProduct({{1}, {1}})->ArgNames({"Producer Count", "Consumer Count"});
+BENCHMARK_TEMPLATE(throughput_benchmark, AdaptiveRingBufferType)->ArgsProduct({{1}, {1}})->ArgNames({"Producer Count", "Consumer Count"});
 
-    ~Thread()
-    {
-        should_stop = true;
-        while (!thread.joinable())
-        {
-        }
-        thread.join();
-    }
-};
+template <typename WaitStrategy>
+using WaitStrategyMcmpRingBufferType = Iyp::WaitFreeRingBufferUtilities::RingBuffer<Iyp::WaitFreeRingBufferUtilities::ConfiguredPolicies<Iyp::WaitFreeRingBufferUtilities::PolicyConfiguration<WaitStrategy>>::template MultiProducer,
+                                                                                    Iyp::WaitFreeRingBufferUtilities::ConfiguredPolicies<Iyp::WaitFreeRingBufferUtilities::PolicyConfiguration<WaitStrategy>>::template MultiConsumer,
+                                                                                    std::size_t,
+                                                                                    RingSize>;
 
-template <typename RingType>
-void throughput_benchmark(benchmark::State &state)
+static double process_cpu_seconds()
 {
+#ifdef __unix__
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1e-6;
+#else
+    return 0.0;
+#endif
+}
+
+template <typename WaitStrategy>
+void wait_strategy_benchmark(benchmark::State &state)
+{
+    using RingType = WaitStrategyMcmpRingBufferType<WaitStrategy>;
     constexpr std::size_t NumberOfProcessedElementsPerIteration = RingSize * 8;
     RingType ring;
-    for (std::size_t i = 0; i < RingSize / 2; i++)
-        ring.push(i);
 
-    std::list<Thread<RingType>> threads;
+    const auto producer_count = static_cast<std::size_t>(state.range(0));
+    const auto consumer_count = static_cast<std::size_t>(state.range(1));
+    std::list<Thread<RingType, WaitStrategy>> threads;
+
+    for (std::size_t i = 0; i < producer_count; i++)
+        threads.emplace_back(ring, ThreadType::PRODUCER, NumberOfProcessedElementsPerIteration * consumer_count);
 
-    for (std::size_t i = 0; i < state.range(0); i++)
-        threads.emplace_back(ring, ThreadType::PRODUCER, NumberOfProcessedElementsPerIteration * state.range(1));
+    for (std::size_t i = 0; i < consumer_count; i++)
+        threads.emplace_back(ring, ThreadType::CONSUMER, NumberOfProcessedElementsPerIteration * producer_count);
 
-    for (std::size_t i = 0; i < state.range(1); i++)
-        threads.emplace_back(ring, ThreadType::CONSUMER, NumberOfProcessedElementsPerIteration * state.range(0));
+    const double start_cpu_seconds = process_cpu_seconds();
+    const auto start_time = std::chrono::steady_clock::now();
 
     for (auto _ : state)
     {
@@ -140,10 +136,13 @@ void throughput_benchmark(benchmark::State &state)
             thread.wait_for_iteration_to_end();
     }
 
-    state.SetComplexityN((state.range(0) + state.range(1)) * NumberOfProcessedElementsPerIteration * state.range(0) * state.range(1));
+    const double wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    state.SetItemsProcessed(state.iterations() * NumberOfProcessedElementsPerIteration * producer_count * consumer_count);
+    state.counters["cpu_utilization"] = wall_seconds > 0.0 ? (process_cpu_seconds() - start_cpu_seconds) / wall_seconds : 0.0;
 }
 
-BENCHMARK_TEMPLATE(throughput_benchmark, ScmpRingBufferType)->ArgsProduct({{1, 2, 3, 4, 5, 6, 7}, {1}})->ArgNames({"Producer Count", "Consumer Count"})->Complexity();
-BENCHMARK_TEMPLATE(throughput_benchmark, McspRingBufferType)->ArgsProduct({{1}, {1, 2, 3, 4, 5, 6, 7}})->ArgNames({"Producer Count", "Consumer Count"})->Complexity();
-BENCHMARK_TEMPLATE(throughput_benchmark, McmpRingBufferType)->ArgsProduct({{1, 2, 3, 4}, {1, 2, 3, 4}})->ArgNames({"Producer Count", "Consumer Count"})->Complexity();
-BENCHMARK_TEMPLATE(throughput_benchmark, ScspRingBufferType)->ArgsProduct({{1}, {1}})->ArgNames({"Producer Count", "Consumer Count"});
+BENCHMARK_TEMPLATE(wait_strategy_benchmark, Iyp::WaitFreeRingBufferUtilities::BusySpinWait)->ArgsProduct({{1, 2, 4}, {1, 2, 4}})->ArgNames({"Producer Count", "Consumer Count"})->UseRealTime();
+BENCHMARK_TEMPLATE(wait_strategy_benchmark, Iyp::WaitFreeRingBufferUtilities::PauseWait)->ArgsProduct({{1, 2, 4}, {1, 2, 4}})->ArgNames({"Producer Count", "Consumer Count"})->UseRealTime();
+BENCHMARK_TEMPLATE(wait_strategy_benchmark, Iyp::WaitFreeRingBufferUtilities::ExponentialBackoffWait<>)->ArgsProduct({{1, 2, 4}, {1, 2, 4}})->ArgNames({"Producer Count", "Consumer Count"})->UseRealTime();
+BENCHMARK_TEMPLATE(wait_strategy_benchmark, Iyp::WaitFreeRingBufferUtilities::YieldWait)->ArgsProduct({{1, 2, 4}, {1, 2, 4}})->ArgNames({"Producer Count", "Consumer Count"})->UseRealTime();
+BENCHMARK_TEMPLATE(wait_strategy_benchmark, Iyp::WaitFreeRingBufferUtilities::SleepWait<>)->ArgsProduct({{1, 2, 4}, {1, 2, 4}})->ArgNames({"Producer Count", "Consumer Count"})->UseRealTime();
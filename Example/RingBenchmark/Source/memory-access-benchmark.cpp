@@ -0,0 +1,82 @@
+#include "payloads.inl"
+
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/details/aligned-allocation.inl>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <thread>
+
+namespace
+{
+constexpr std::size_t RingSize = 1024;
+constexpr std::size_t NumberOfMessagesPerIteration = 8192;
+
+template <typename Configuration, typename ElementType>
+using ConfiguredSpscRingBufferType = Iyp::WaitFreeRingBufferUtilities::RingBuffer<Iyp::WaitFreeRingBufferUtilities::ConfiguredPolicies<Configuration>::template SingleProducer,
+                                                                                  Iyp::WaitFreeRingBufferUtilities::ConfiguredPolicies<Configuration>::template SingleConsumer,
+                                                                                  ElementType,
+                                                                                  RingSize>;
+
+// The producer pushes copies of a message it filled in, which is what the streaming store path applies to.
+template <typename Configuration, std::size_t Size>
+void memory_access_benchmark(benchmark::State &state)
+{
+    using PayloadType = Payload<Size>;
+    const auto ring = Iyp::WaitFreeRingBufferUtilities::Details::make_aligned_unique<ConfiguredSpscRingBufferType<Configuration, PayloadType>>();
+    std::size_t checksum = 0;
+
+    for (auto _ : state)
+    {
+        std::thread consumer([&ring, &checksum]() {
+            for (std::size_t i = 0; i < NumberOfMessagesPerIteration; i++)
+            {
+                const auto message = Iyp::WaitFreeRingBufferUtilities::pop_wait(*ring);
+                checksum += message.data[0];
+            }
+        });
+
+        PayloadType message(0);
+        for (std::size_t i = 0; i < NumberOfMessagesPerIteration; i++)
+        {
+            std::memcpy(message.data, &i, sizeof(i));
+            Iyp::WaitFreeRingBufferUtilities::push_wait(*ring, message);
+        }
+        consumer.join();
+    }
+
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(state.iterations() * NumberOfMessagesPerIteration);
+    state.SetBytesProcessed(state.iterations() * NumberOfMessagesPerIteration * Size);
+}
+
+using DefaultConfiguration = Iyp::WaitFreeRingBufferUtilities::DefaultPolicyConfiguration;
+using PrefetchConfiguration = Iyp::WaitFreeRingBufferUtilities::PolicyConfiguration<Iyp::WaitFreeRingBufferUtilities::BusySpinWait, 4>;
+using StreamingStoreConfiguration = Iyp::WaitFreeRingBufferUtilities::PolicyConfiguration<Iyp::WaitFreeRingBufferUtilities::BusySpinWait, 0, 256>;
+using PrefetchAndStreamingStoreConfiguration = Iyp::WaitFreeRingBufferUtilities::PolicyConfiguration<Iyp::WaitFreeRingBufferUtilities::BusySpinWait, 4, 256>;
+
+template <std::size_t Size>
+void register_configurations()
+{
+    const std::string suffix = "/" + Payload<Size>::name();
+    benchmark::RegisterBenchmark(("memory_access_benchmark/Default" + suffix).c_str(), memory_access_benchmark<DefaultConfiguration, Size>)->UseRealTime();
+    benchmark::RegisterBenchmark(("memory_access_benchmark/Prefetch" + suffix).c_str(), memory_access_benchmark<PrefetchConfiguration, Size>)->UseRealTime();
+    benchmark::RegisterBenchmark(("memory_access_benchmark/StreamingStore" + suffix).c_str(), memory_access_benchmark<StreamingStoreConfiguration, Size>)->UseRealTime();
+    benchmark::RegisterBenchmark(("memory_access_benchmark/PrefetchAndStreamingStore" + suffix).c_str(), memory_access_benchmark<PrefetchAndStreamingStoreConfiguration, Size>)->UseRealTime();
+}
+
+bool register_memory_access_benchmarks()
+{
+    register_configurations<64>();
+    register_configurations<256>();
+    register_configurations<512>();
+    register_configurations<1024>();
+    register_configurations<4096>();
+    return true;
+}
+
+const bool are_memory_access_benchmarks_registered = register_memory_access_benchmarks();
+} // namespace
@@ -0,0 +1,108 @@
+#include "payloads.inl"
+
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/object-pool.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/details/aligned-allocation.inl>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+constexpr std::size_t RingSize = 1024;
+constexpr std::size_t NumberOfMessagesPerIteration = 8192;
+
+template <typename ElementType>
+using SpscRingBufferType = Iyp::WaitFreeRingBufferUtilities::RingBuffer<Iyp::WaitFreeRingBufferUtilities::SingleProducer,
+                                                                        Iyp::WaitFreeRingBufferUtilities::SingleConsumer,
+                                                                        ElementType,
+                                                                        RingSize>;
+
+// The producer fills in a message of its own and the ring copies it into a slot, the consumer copies it out again.
+template <std::size_t Size>
+void by_value_benchmark(benchmark::State &state)
+{
+    using PayloadType = Payload<Size>;
+    const auto ring = Iyp::WaitFreeRingBufferUtilities::Details::make_aligned_unique<SpscRingBufferType<PayloadType>>();
+    std::size_t checksum = 0;
+
+    for (auto _ : state)
+    {
+        std::thread consumer([&ring, &checksum]() {
+            for (std::size_t i = 0; i < NumberOfMessagesPerIteration; i++)
+            {
+                const auto message = Iyp::WaitFreeRingBufferUtilities::pop_wait(*ring);
+                checksum += message.data[Size - 1];
+            }
+        });
+
+        PayloadType message(0);
+        for (std::size_t i = 0; i < NumberOfMessagesPerIteration; i++)
+        {
+            std::memcpy(message.data, &i, sizeof(i));
+            Iyp::WaitFreeRingBufferUtilities::push_wait(*ring, message);
+        }
+        consumer.join();
+    }
+
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(state.iterations() * NumberOfMessagesPerIteration);
+    state.SetBytesProcessed(state.iterations() * NumberOfMessagesPerIteration * Size);
+}
+
+// The producer fills in a pooled message and only the handle goes through the ring. Each thread keeps a cache of free objects.
+template <std::size_t Size>
+void pooled_benchmark(benchmark::State &state)
+{
+    using PayloadType = Payload<Size>;
+    using PoolType = Iyp::WaitFreeRingBufferUtilities::ObjectPool<PayloadType, RingSize * 2>;
+    using CacheType = Iyp::WaitFreeRingBufferUtilities::ObjectPoolCache<PoolType>;
+
+    const auto pool = Iyp::WaitFreeRingBufferUtilities::Details::make_aligned_unique<PoolType>(std::size_t(0));
+    const auto ring = Iyp::WaitFreeRingBufferUtilities::Details::make_aligned_unique<SpscRingBufferType<typename PoolType::Handle>>();
+    std::size_t checksum = 0;
+
+    for (auto _ : state)
+    {
+        std::thread consumer([&pool, &ring, &checksum]() {
+            CacheType cache(*pool);
+            for (std::size_t i = 0; i < NumberOfMessagesPerIteration; i++)
+            {
+                auto handle = Iyp::WaitFreeRingBufferUtilities::pop_wait(*ring);
+                checksum += handle->data[Size - 1];
+                cache.release(std::move(handle));
+            }
+        });
+
+        {
+            CacheType cache(*pool);
+            for (std::size_t i = 0; i < NumberOfMessagesPerIteration; i++)
+            {
+                auto handle = cache.acquire();
+                while (!handle)
+                    handle = cache.acquire();
+
+                std::memcpy(handle->data, &i, sizeof(i));
+                Iyp::WaitFreeRingBufferUtilities::push_wait(*ring, std::move(handle));
+            }
+        }
+        consumer.join();
+    }
+
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(state.iterations() * NumberOfMessagesPerIteration);
+    state.SetBytesProcessed(state.iterations() * NumberOfMessagesPerIteration * Size);
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(by_value_benchmark, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(pooled_benchmark, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(by_value_benchmark, 512)->UseRealTime();
+BENCHMARK_TEMPLATE(pooled_benchmark, 512)->UseRealTime();
+BENCHMARK_TEMPLATE(by_value_benchmark, 4096)->UseRealTime();
+BENCHMARK_TEMPLATE(pooled_benchmark, 4096)->UseRealTime();
+BENCHMARK_TEMPLATE(by_value_benchmark, 16384)->UseRealTime();
+BENCHMARK_TEMPLATE(pooled_benchmark, 16384)->UseRealTime();
@@ -0,0 +1,109 @@
+#include "benchmark-thread.inl"
+#include "competing-queues.inl"
+#include "payloads.inl"
+
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/segmented-ring-buffer.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/details/aligned-allocation.inl>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace
+{
+template <typename ElementType, std::size_t Count>
+using McmpRingBufferType = Iyp::WaitFreeRingBufferUtilities::RingBuffer<Iyp::WaitFreeRingBufferUtilities::MultiProducer,
+                                                                        Iyp::WaitFreeRingBufferUtilities::MultiConsumer,
+                                                                        ElementType,
+                                                                        Count>;
+
+template <typename ElementType, std::size_t Count>
+using ScspRingBufferType = Iyp::WaitFreeRingBufferUtilities::RingBuffer<Iyp::WaitFreeRingBufferUtilities::SingleProducer,
+                                                                        Iyp::WaitFreeRingBufferUtilities::SingleConsumer,
+                                                                        ElementType,
+                                                                        Count>;
+
+// Segments no larger than the fixed rings, so that the larger ring sizes also exercise chaining.
+template <typename ElementType, std::size_t Count>
+using SegmentedRingBufferType = Iyp::WaitFreeRingBufferUtilities::SegmentedRingBuffer<ElementType, (Count < 1024 ? Count : 1024)>;
+
+constexpr std::size_t NumberOfProcessedElementsPerIteration = 8192;
+
+template <typename QueueType, std::size_t Count>
+void payload_benchmark(benchmark::State &state)
+{
+    const auto queue = Iyp::WaitFreeRingBufferUtilities::Details::make_aligned_unique<QueueType>();
+    for (std::size_t i = 0; i < Count / 2; i++)
+        queue->push(i);
+
+    const auto producer_count = static_cast<std::size_t>(state.range(0));
+    const auto consumer_count = static_cast<std::size_t>(state.range(1));
+    std::list<Thread<QueueType>> threads;
+
+    for (std::size_t i = 0; i < producer_count; i++)
+        threads.emplace_back(*queue, ThreadType::PRODUCER, NumberOfProcessedElementsPerIteration * consumer_count);
+
+    for (std::size_t i = 0; i < consumer_count; i++)
+        threads.emplace_back(*queue, ThreadType::CONSUMER, NumberOfProcessedElementsPerIteration * producer_count);
+
+    for (auto _ : state)
+    {
+        for (auto &thread : threads)
+            thread.run_an_iteration();
+        for (auto &thread : threads)
+            thread.wait_for_iteration_to_end();
+    }
+
+    state.SetItemsProcessed(state.iterations() * NumberOfProcessedElementsPerIteration * producer_count * consumer_count);
+}
+
+template <template <typename, std::size_t> class Queue, typename PayloadType, std::size_t Count>
+void register_payload_benchmark(const std::string &queue_name, const bool is_single_producer = false, const bool is_single_consumer = false)
+{
+    const std::string name = "payload_benchmark/" + queue_name + "/" + PayloadType::name() + "/RingSize:" + std::to_string(Count);
+    auto *const registered = benchmark::RegisterBenchmark(name.c_str(), payload_benchmark<Queue<PayloadType, Count>, Count>);
+
+    registered->ArgsProduct({is_single_producer ? std::vector<std::int64_t>{1} : std::vector<std::int64_t>{1, 4},
+                             is_single_consumer ? std::vector<std::int64_t>{1} : std::vector<std::int64_t>{1, 4}});
+    registered->ArgNames({"Producer Count", "Consumer Count"})->UseRealTime();
+}
+
+template <typename PayloadType, std::size_t Count>
+void register_queue_comparison()
+{
+    register_payload_benchmark<ScspRingBufferType, PayloadType, Count>("ScspRingBuffer", true, true);
+    register_payload_benchmark<McmpRingBufferType, PayloadType, Count>("McmpRingBuffer");
+    register_payload_benchmark<SegmentedRingBufferType, PayloadType, Count>("SegmentedRingBuffer", false, true);
+    register_payload_benchmark<VyukovBoundedQueue, PayloadType, Count>("VyukovBoundedQueue");
+    register_payload_benchmark<MutexDequeQueue, PayloadType, Count>("MutexDequeQueue");
+}
+
+template <typename PayloadType>
+void register_ring_sizes()
+{
+    register_queue_comparison<PayloadType, 64>();
+    register_queue_comparison<PayloadType, 1024>();
+    register_queue_comparison<PayloadType, 65536>();
+}
+
+bool register_payload_benchmarks()
+{
+    register_ring_sizes<Payload<8>>();
+    register_ring_sizes<Payload<64>>();
+    register_ring_sizes<Payload<512>>();
+    register_ring_sizes<StringPayload>();
+
+    // Slots of the largest payload would take over half a gigabyte at this size.
+    register_queue_comparison<Payload<8>, 1 << 20>();
+    register_queue_comparison<Payload<64>, 1 << 20>();
+    register_queue_comparison<StringPayload, 1 << 20>();
+    return true;
+}
+
+const bool are_payload_benchmarks_registered = register_payload_benchmarks();
+} // namespace
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+template <std::size_t Size>
+struct Payload
+{
+    static_assert(Size >= sizeof(std::size_t), "Payload should be able to hold its index.");
+
+    std::uint8_t data[Size];
+
+    explicit Payload(const std::size_t index)
+    {
+        std::memcpy(data, &index, sizeof(index));
+    }
+
+    static std::string name()
+    {
+        return std::to_string(Size) + "B";
+    }
+};
+
+struct StringPayload
+{
+    std::string value;
+
+    // Long enough to defeat the small string optimization, so every element owns a heap allocation.
+    explicit StringPayload(const std::size_t index) : value(48, static_cast<char>('a' + index % 26))
+    {
+    }
+
+    static std::string name()
+    {
+        return "std::string";
+    }
+};
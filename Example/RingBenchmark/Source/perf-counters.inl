@@ -0,0 +1,159 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+enum : std::size_t
+{
+    PERF_COUNTER_COUNT = 5,
+};
+
+// Sum of the PerfCounters of several threads, reported per operation as benchmark user counters.
+class PerfCounterTotals
+{
+    friend class PerfCounters;
+
+    std::array<double, PERF_COUNTER_COUNT> values{};
+    std::array<bool, PERF_COUNTER_COUNT> is_read{};
+    double min_running_ratio{1.0};
+
+public:
+    void report(benchmark::State &state, const double operation_count) const
+    {
+        static const char *const names[PERF_COUNTER_COUNT] = {"cache_misses_per_op",
+                                                              "branch_misses_per_op",
+                                                              "instructions_per_op",
+                                                              "cycles_per_op",
+                                                              "hitm_per_op"};
+        if (operation_count <= 0.0)
+            return;
+
+        bool has_any_value = false;
+        for (std::size_t i = 0; i < PERF_COUNTER_COUNT; i++)
+            if (is_read[i])
+            {
+                state.counters[names[i]] = values[i] / operation_count;
+                has_any_value = true;
+            }
+
+        // Below 1 when the kernel multiplexed the counters, the values above are then extrapolated from that share of the time.
+        if (has_any_value && min_running_ratio < 1.0)
+            state.counters["perf_running_ratio"] = min_running_ratio;
+    }
+};
+
+// Hardware counters of the thread that calls open(), counting only between start() and stop() so that a worker can leave out the
+// time it spins between iterations. Counters the kernel refuses, for example because of perf_event_paranoid, in containers or
+// virtual machines, are left out of the report. Snoops that hit a modified line in another core (HITM) have no generic event, the
+// raw event code of the CPU at hand can be given in hexadecimal through the RING_BENCHMARK_HITM_EVENT environment variable, e.g.
+// 0x04d2 for MEM_LOAD_L3_HIT_RETIRED.XSNP_HITM on Skylake.
+class PerfCounters
+{
+    std::array<int, PERF_COUNTER_COUNT> file_descriptors{{-1, -1, -1, -1, -1}};
+
+#ifdef __linux__
+    static int open_counter(const std::uint32_t type, const std::uint64_t config)
+    {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.size = sizeof(attributes);
+        attributes.type = type;
+        attributes.config = config;
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+    }
+
+    void control(const unsigned long request)
+    {
+        for (const int file_descriptor : file_descriptors)
+            if (file_descriptor >= 0)
+                ioctl(file_descriptor, request, 0);
+    }
+#endif
+
+public:
+    PerfCounters() = default;
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    void open()
+    {
+#ifdef __linux__
+        file_descriptors[0] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+        file_descriptors[1] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        file_descriptors[2] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        file_descriptors[3] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        if (const char *const hitm_event = std::getenv("RING_BENCHMARK_HITM_EVENT"))
+            file_descriptors[4] = open_counter(PERF_TYPE_RAW, std::strtoull(hitm_event, nullptr, 16));
+#endif
+    }
+
+    void start()
+    {
+#ifdef __linux__
+        control(PERF_EVENT_IOC_ENABLE);
+#endif
+    }
+
+    void stop()
+    {
+#ifdef __linux__
+        control(PERF_EVENT_IOC_DISABLE);
+#endif
+    }
+
+    // Adds the counts so far, scaled up by the time the counters were enabled over the time they actually ran.
+    void add_to(PerfCounterTotals &totals) const
+    {
+#ifdef __linux__
+        for (std::size_t i = 0; i < PERF_COUNTER_COUNT; i++)
+        {
+            struct
+            {
+                std::uint64_t value;
+                std::uint64_t time_enabled;
+                std::uint64_t time_running;
+            } reading;
+            if (file_descriptors[i] < 0 || read(file_descriptors[i], &reading, sizeof(reading)) != sizeof(reading))
+                continue;
+
+            totals.is_read[i] = true;
+            if (!reading.time_running)
+                continue;
+
+            const double running_ratio = static_cast<double>(reading.time_running) / static_cast<double>(reading.time_enabled);
+            totals.values[i] += static_cast<double>(reading.value) / running_ratio;
+            totals.min_running_ratio = std::min(totals.min_running_ratio, running_ratio);
+        }
+#else
+        (void)totals;
+#endif
+    }
+
+    ~PerfCounters()
+    {
+#ifdef __linux__
+        for (const int file_descriptor : file_descriptors)
+            if (file_descriptor >= 0)
+                close(file_descriptor);
+#endif
+    }
+};
@@ -0,0 +1,333 @@
+#include "benchmark-thread.inl"
+
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/details/aligned-allocation.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/details/thread-affinity.inl>
+
+#include <benchmark/benchmark.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <list>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t RingSize = 1024;
+constexpr std::size_t NumberOfProcessedElementsPerIteration = RingSize * 8;
+
+struct CpuTopology
+{
+    int cpu;
+    int package_id;
+    int core_id;
+    int l3_id; // Lowest cpu sharing the L3, or -1 if the L3 is unknown.
+};
+
+std::string read_sysfs_line(const std::string &path)
+{
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+// Parses cpu lists such as "0-3,8,10-11".
+std::vector<int> parse_cpu_list(const std::string &list)
+{
+    std::vector<int> cpus;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ','))
+    {
+        int first = 0;
+        int last = 0;
+        const int matched_count = std::sscanf(range.c_str(), "%d-%d", &first, &last);
+        if (matched_count < 1)
+            continue;
+        for (int cpu = first; cpu <= (matched_count == 2 ? last : first); cpu++)
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+int read_sysfs_int(const std::string &path, const int default_value)
+{
+    int value = default_value;
+    std::sscanf(read_sysfs_line(path).c_str(), "%d", &value);
+    return value;
+}
+
+// The cpus this process may run on, which under taskset or a cpuset can be far fewer than the online ones.
+std::vector<int> read_allowed_cpus()
+{
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0)
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            if (CPU_ISSET(cpu, &cpu_set))
+                cpus.push_back(cpu);
+#endif
+    return cpus;
+}
+
+std::vector<CpuTopology> read_cpu_topology()
+{
+    std::vector<CpuTopology> topology;
+    const std::string root = "/sys/devices/system/cpu/";
+
+    for (const int cpu : read_allowed_cpus())
+    {
+        const std::string cpu_root = root + "cpu" + std::to_string(cpu) + "/";
+        CpuTopology cpu_topology{cpu,
+                                 read_sysfs_int(cpu_root + "topology/physical_package_id", 0),
+                                 read_sysfs_int(cpu_root + "topology/core_id", cpu),
+                                 -1};
+
+        for (int index = 0; index < 8; index++)
+        {
+            const std::string cache_root = cpu_root + "cache/index" + std::to_string(index) + "/";
+            if (read_sysfs_int(cache_root + "level", 0) != 3)
+                continue;
+
+            const auto shared_cpus = parse_cpu_list(read_sysfs_line(cache_root + "shared_cpu_list"));
+            if (!shared_cpus.empty())
+                cpu_topology.l3_id = shared_cpus.front();
+            break;
+        }
+
+        topology.push_back(cpu_topology);
+    }
+
+    return topology;
+}
+
+enum class Placement
+{
+    SMT_SIBLING,
+    SAME_L3,
+    DIFFERENT_L3,
+    CROSS_SOCKET,
+};
+
+const char *placement_name(const Placement placement)
+{
+    switch (placement)
+    {
+    case Placement::SMT_SIBLING:
+        return "SmtSibling";
+    case Placement::SAME_L3:
+        return "SameL3";
+    case Placement::DIFFERENT_L3:
+        return "DifferentL3";
+    case Placement::CROSS_SOCKET:
+        return "CrossSocket";
+    }
+    return "";
+}
+
+bool matches(const Placement placement, const CpuTopology &a, const CpuTopology &b)
+{
+    const bool is_same_package = a.package_id == b.package_id;
+    const bool is_same_core = is_same_package && a.core_id == b.core_id;
+    const bool is_same_l3 = is_same_package && a.l3_id == b.l3_id && a.l3_id >= 0;
+
+    switch (placement)
+    {
+    case Placement::SMT_SIBLING:
+        return is_same_core;
+    case Placement::SAME_L3:
+        return is_same_l3 && !is_same_core;
+    case Placement::DIFFERENT_L3:
+        return is_same_package && !is_same_l3 && a.l3_id >= 0 && b.l3_id >= 0;
+    case Placement::CROSS_SOCKET:
+        return !is_same_package;
+    }
+    return false;
+}
+
+// The first pair of allowed cpus with the placement, if any.
+bool find_cpu_pair(const std::vector<CpuTopology> &topology, const Placement placement, std::pair<int, int> &cpu_pair)
+{
+    for (std::size_t i = 0; i < topology.size(); i++)
+        for (std::size_t j = i + 1; j < topology.size(); j++)
+            if (matches(placement, topology[i], topology[j]))
+            {
+                cpu_pair = {topology[i].cpu, topology[j].cpu};
+                return true;
+            }
+    return false;
+}
+
+// Any allowed cpu outside the pair, or -1 if there is none.
+int find_third_cpu(const std::vector<CpuTopology> &topology, const std::pair<int, int> &cpu_pair)
+{
+    for (const CpuTopology &cpu_topology : topology)
+        if (cpu_topology.cpu != cpu_pair.first && cpu_topology.cpu != cpu_pair.second)
+            return cpu_topology.cpu;
+    return -1;
+}
+
+// Pins the benchmarking thread for the duration of a benchmark run, and then restores its affinity for the next benchmarks.
+class ScopedCpuPin
+{
+#ifdef __linux__
+    cpu_set_t original_cpu_set;
+    bool has_original_cpu_set;
+#endif
+    bool is_pinned;
+
+public:
+    explicit ScopedCpuPin(const int cpu)
+    {
+#ifdef __linux__
+        has_original_cpu_set = pthread_getaffinity_np(pthread_self(), sizeof(original_cpu_set), &original_cpu_set) == 0;
+#endif
+        is_pinned = Iyp::WaitFreeRingBufferUtilities::Details::pin_current_thread_to_cpu(cpu);
+    }
+
+    ScopedCpuPin(const ScopedCpuPin &) = delete;
+    ScopedCpuPin &operator=(const ScopedCpuPin &) = delete;
+
+    bool has_failed() const
+    {
+        return !is_pinned;
+    }
+
+    ~ScopedCpuPin()
+    {
+#ifdef __linux__
+        if (has_original_cpu_set)
+            pthread_setaffinity_np(pthread_self(), sizeof(original_cpu_set), &original_cpu_set);
+#endif
+    }
+};
+
+template <template <typename, std::size_t> class Producer, template <typename, std::size_t> class Consumer>
+using TopologyRingBufferType = Iyp::WaitFreeRingBufferUtilities::RingBuffer<Producer, Consumer, std::size_t, RingSize>;
+
+// One producer on the first cpu of the pair and one consumer on the second. The benchmarking thread spins on a third cpu while
+// waiting for them, or sleeps if the pair are the only cpus it may use.
+template <typename RingType>
+void topology_throughput_benchmark(benchmark::State &state)
+{
+    const auto ring = Iyp::WaitFreeRingBufferUtilities::Details::make_aligned_unique<RingType>();
+    std::list<Thread<RingType>> threads;
+    threads.emplace_back(*ring, ThreadType::PRODUCER, NumberOfProcessedElementsPerIteration, static_cast<int>(state.range(0)));
+    threads.emplace_back(*ring, ThreadType::CONSUMER, NumberOfProcessedElementsPerIteration, static_cast<int>(state.range(1)));
+    for (const auto &thread : threads)
+        if (thread.has_pinning_failed())
+        {
+            state.SkipWithError("Could not pin a worker thread.");
+            return;
+        }
+
+    const int main_cpu = static_cast<int>(state.range(2));
+    const ScopedCpuPin cpu_pin(main_cpu);
+    if (main_cpu >= 0 && cpu_pin.has_failed())
+    {
+        state.SkipWithError("Could not pin the benchmarking thread.");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        for (auto &thread : threads)
+            thread.run_an_iteration();
+        for (auto &thread : threads)
+            if (main_cpu >= 0)
+                thread.wait_for_iteration_to_end();
+            else
+                thread.template wait_for_iteration_to_end<Iyp::WaitFreeRingBufferUtilities::SleepWait<10>>();
+    }
+
+    state.SetItemsProcessed(state.iterations() * NumberOfProcessedElementsPerIteration);
+}
+
+// Ping-pong over a pair of rings, every iteration is one round trip between the two cpus.
+template <typename RingType>
+void topology_latency_benchmark(benchmark::State &state)
+{
+    const auto requests = Iyp::WaitFreeRingBufferUtilities::Details::make_aligned_unique<RingType>();
+    const auto responses = Iyp::WaitFreeRingBufferUtilities::Details::make_aligned_unique<RingType>();
+    std::atomic_bool should_stop{false};
+    std::atomic_int echo_pinning{-1}; // Whether the echo thread could pin itself, once it has tried.
+
+    const ScopedCpuPin cpu_pin(static_cast<int>(state.range(0)));
+    std::thread echo([&requests, &responses, &should_stop, &echo_pinning, &state]() {
+        echo_pinning = Iyp::WaitFreeRingBufferUtilities::Details::pin_current_thread_to_cpu(static_cast<std::size_t>(state.range(1)));
+        while (!should_stop.load(std::memory_order_relaxed))
+            if (auto request = requests->pop())
+                Iyp::WaitFreeRingBufferUtilities::push_wait(*responses, *request);
+    });
+
+    while (echo_pinning < 0)
+        std::this_thread::yield();
+    if (cpu_pin.has_failed() || !echo_pinning)
+    {
+        should_stop = true;
+        echo.join();
+        state.SkipWithError("Could not pin the client or the echo thread.");
+        return;
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Iyp::WaitFreeRingBufferUtilities::push_wait(*requests, i++);
+        benchmark::DoNotOptimize(Iyp::WaitFreeRingBufferUtilities::pop_wait(*responses));
+    }
+
+    should_stop = true;
+    echo.join();
+}
+
+template <typename RingType>
+void register_placements(const std::string &ring_name, const std::vector<CpuTopology> &topology)
+{
+    for (const Placement placement : {Placement::SMT_SIBLING, Placement::SAME_L3, Placement::DIFFERENT_L3, Placement::CROSS_SOCKET})
+    {
+        std::pair<int, int> cpu_pair;
+        if (!find_cpu_pair(topology, placement, cpu_pair))
+            continue;
+
+        const std::string suffix = "/" + ring_name + "/" + placement_name(placement);
+        benchmark::RegisterBenchmark(("topology_throughput_benchmark" + suffix).c_str(), topology_throughput_benchmark<RingType>)
+            ->Args({cpu_pair.first, cpu_pair.second, find_third_cpu(topology, cpu_pair)})
+            ->ArgNames({"Producer Cpu", "Consumer Cpu", "Main Cpu"})
+            ->UseRealTime();
+        benchmark::RegisterBenchmark(("topology_latency_benchmark" + suffix).c_str(), topology_latency_benchmark<RingType>)
+            ->Args({cpu_pair.first, cpu_pair.second})
+            ->ArgNames({"Client Cpu", "Echo Cpu"})
+            ->UseRealTime();
+    }
+}
+
+// Placements that the machine does not have, e.g. cross socket on a single socket machine, are not registered.
+bool register_topology_benchmarks()
+{
+    using namespace Iyp::WaitFreeRingBufferUtilities;
+    const auto topology = read_cpu_topology();
+
+    register_placements<TopologyRingBufferType<SingleProducer, SingleConsumer>>("ScspRingBuffer", topology);
+    register_placements<TopologyRingBufferType<MultiProducer, SingleConsumer>>("ScmpRingBuffer", topology);
+    register_placements<TopologyRingBufferType<SingleProducer, MultiConsumer>>("McspRingBuffer", topology);
+    register_placements<TopologyRingBufferType<MultiProducer, MultiConsumer>>("McmpRingBuffer", topology);
+    register_placements<TopologyRingBufferType<OrderedMultiProducer, OrderedMultiConsumer>>("OrderedMcmpRingBuffer", topology);
+    return true;
+}
+
+const bool are_topology_benchmarks_registered = register_topology_benchmarks();
+} // namespace
@@ -0,0 +1,104 @@
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/traffic-trace.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/details/aligned-allocation.inl>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t RingSize = 1024;
+
+template <template <typename, std::size_t> class Producer, template <typename, std::size_t> class Consumer>
+using ReplayRingBufferType = Iyp::WaitFreeRingBufferUtilities::RingBuffer<Producer, Consumer, std::size_t, RingSize>;
+
+std::vector<Iyp::WaitFreeRingBufferUtilities::TraceEvent> trace_events;
+double trace_rate_scale = 1.0;
+
+// Each iteration replays the whole trace against a fresh ring.
+template <typename RingType>
+void trace_replay_benchmark(benchmark::State &state)
+{
+    Iyp::WaitFreeRingBufferUtilities::TraceReplayResult total{};
+    for (auto _ : state)
+    {
+        const auto ring = Iyp::WaitFreeRingBufferUtilities::Details::make_aligned_unique<RingType>();
+        const auto result = Iyp::WaitFreeRingBufferUtilities::replay_trace(*ring, trace_events, trace_rate_scale);
+        state.SetIterationTime(std::chrono::duration<double>(result.duration).count());
+
+        total.max_lateness = std::max(total.max_lateness, result.max_lateness);
+        total.failed_push_attempt_count += result.failed_push_attempt_count;
+        total.failed_pop_attempt_count += result.failed_pop_attempt_count;
+        total.abandoned_count += result.abandoned_count;
+    }
+
+    state.SetItemsProcessed(state.iterations() * trace_events.size());
+    state.counters["max_lateness_us"] = std::chrono::duration<double, std::micro>(total.max_lateness).count();
+    state.counters["failed_pushes"] = benchmark::Counter(total.failed_push_attempt_count, benchmark::Counter::kAvgIterations);
+    state.counters["failed_pops"] = benchmark::Counter(total.failed_pop_attempt_count, benchmark::Counter::kAvgIterations);
+    state.counters["abandoned"] = benchmark::Counter(total.abandoned_count, benchmark::Counter::kAvgIterations);
+}
+
+template <typename RingType>
+void register_trace_replay(const std::string &ring_name)
+{
+    benchmark::RegisterBenchmark(("trace_replay_benchmark/" + ring_name).c_str(), trace_replay_benchmark<RingType>)->UseManualTime();
+}
+
+// Nothing is registered unless RING_BENCHMARK_TRACE names a trace written by a TracingRingBuffer.
+bool register_trace_replay_benchmarks()
+{
+    using namespace Iyp::WaitFreeRingBufferUtilities;
+
+    const char *const trace_path = std::getenv("RING_BENCHMARK_TRACE");
+    if (!trace_path)
+        return false;
+
+    std::FILE *const file = std::fopen(trace_path, "rb");
+    if (!file)
+    {
+        std::fprintf(stderr, "Could not open the trace %s\n", trace_path);
+        return false;
+    }
+    TraceHeader header;
+    const bool is_read = read_trace(file, header, trace_events);
+    std::fclose(file);
+    if (!is_read)
+    {
+        std::fprintf(stderr, "%s is not a complete ring trace\n", trace_path);
+        return false;
+    }
+
+    if (const char *const rate_scale = std::getenv("RING_BENCHMARK_TRACE_RATE"))
+        trace_rate_scale = std::strtod(rate_scale, nullptr);
+
+    // Single producer/consumer policies are only replayed when the trace had one thread on that side.
+    std::set<std::uint32_t> pushing_threads;
+    std::set<std::uint32_t> popping_threads;
+    for (const auto &event : trace_events)
+        (event.kind == TraceEventKind::PUSH ? pushing_threads : popping_threads).insert(event.thread_index);
+    const bool has_single_producer = pushing_threads.size() <= 1;
+    const bool has_single_consumer = popping_threads.size() <= 1;
+
+    if (has_single_producer && has_single_consumer)
+        register_trace_replay<ReplayRingBufferType<SingleProducer, SingleConsumer>>("ScspRingBuffer");
+    if (has_single_consumer)
+        register_trace_replay<ReplayRingBufferType<MultiProducer, SingleConsumer>>("ScmpRingBuffer");
+    if (has_single_producer)
+        register_trace_replay<ReplayRingBufferType<SingleProducer, MultiConsumer>>("McspRingBuffer");
+    register_trace_replay<ReplayRingBufferType<MultiProducer, MultiConsumer>>("McmpRingBuffer");
+    register_trace_replay<ReplayRingBufferType<OrderedMultiProducer, OrderedMultiConsumer>>("OrderedMcmpRingBuffer");
+    return true;
+}
+
+const bool are_trace_replay_benchmarks_registered = register_trace_replay_benchmarks();
+} // namespace
@@ -0,0 +1,151 @@
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <array>
+#include <thread>
+#include <atomic>
+
+namespace Iyp
+{
+namespace AdaptiveProducerAdaptiveConsumerRingBufferTest
+{
+static constexpr std::size_t RingSize = 64;
+static constexpr std::size_t NumberOfElements = 1 << 16;
+
+using TestRingBufferType = WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::AdaptiveProducer,
+                                                                   WaitFreeRingBufferUtilities::AdaptiveConsumer,
+                                                                   std::size_t,
+                                                                   RingSize>;
+
+TEST(AdaptiveProducerAdaptiveConsumerRingBufferTest, UnattachedRingBehavesLikeSingleProducerSingleConsumer)
+{
+    TestRingBufferType ring;
+    EXPECT_FALSE(ring.pop());
+
+    for (std::size_t try_index = 0; try_index < 16; try_index++)
+    {
+        for (std::size_t i = 0; i < RingSize; i++)
+            EXPECT_TRUE(ring.push(try_index * RingSize + i));
+        EXPECT_FALSE(ring.push(std::size_t(0)));
+
+        for (std::size_t i = 0; i < RingSize; i++)
+            EXPECT_EQ(*ring.pop(), try_index * RingSize + i);
+        EXPECT_FALSE(ring.pop());
+    }
+}
+
+TEST(AdaptiveProducerAdaptiveConsumerRingBufferTest, ProducersAttachAndDetachDuringTraffic)
+{
+    static constexpr std::size_t NumberOfProducerThreads = 2;
+    static constexpr std::size_t ChunkSize = 256;
+
+    TestRingBufferType ring;
+    std::array<std::size_t, NumberOfProducerThreads> next_values{};
+    std::size_t order_violation_count = 0;
+
+    std::thread consumer([&]() {
+        ring.attach_consumer();
+        for (std::size_t i = 0; i < NumberOfElements; i++)
+        {
+            const std::size_t value = WaitFreeRingBufferUtilities::pop_wait<WaitFreeRingBufferUtilities::YieldWait>(ring);
+            if (value % NumberOfElements != next_values[value / NumberOfElements]++)
+                order_violation_count++;
+        }
+        ring.detach_consumer();
+    });
+
+    // The first producer stays attached, the second one keeps attaching for a chunk of pushes and detaching again.
+    std::vector<std::thread> producers;
+    producers.emplace_back([&ring]() {
+        ring.attach_producer();
+        for (std::size_t i = 0; i < NumberOfElements / NumberOfProducerThreads; i++)
+            WaitFreeRingBufferUtilities::push_wait<WaitFreeRingBufferUtilities::YieldWait>(ring, i);
+        ring.detach_producer();
+    });
+    producers.emplace_back([&ring]() {
+        for (std::size_t i = 0; i < NumberOfElements / NumberOfProducerThreads; i++)
+        {
+            if (i % ChunkSize == 0)
+                ring.attach_producer();
+            WaitFreeRingBufferUtilities::push_wait<WaitFreeRingBufferUtilities::YieldWait>(ring, NumberOfElements + i);
+            if (i % ChunkSize == ChunkSize - 1)
+                ring.detach_producer();
+        }
+    });
+
+    for (auto &producer : producers)
+        producer.join();
+    consumer.join();
+
+    EXPECT_EQ(order_violation_count, 0u);
+    for (const auto next_value : next_values)
+        EXPECT_EQ(next_value, NumberOfElements / NumberOfProducerThreads);
+    EXPECT_FALSE(ring.pop());
+}
+
+TEST(AdaptiveProducerAdaptiveConsumerRingBufferTest, ConsumersAttachAndDetachDuringTraffic)
+{
+    static constexpr std::size_t ChunkSize = 256;
+
+    TestRingBufferType ring;
+    std::array<std::atomic_size_t, NumberOfElements> pop_counts;
+    for (auto &pop_count : pop_counts)
+        pop_count = 0;
+    std::atomic_size_t popped_count{0};
+    std::atomic_size_t order_violation_count{0};
+
+    std::thread producer([&ring]() {
+        ring.attach_producer();
+        for (std::size_t i = 0; i < NumberOfElements; i++)
+            WaitFreeRingBufferUtilities::push_wait<WaitFreeRingBufferUtilities::YieldWait>(ring, i);
+        ring.detach_producer();
+    });
+
+    // Elements are popped in FIFO order, so each consumer sees increasing values whichever protocol is running.
+    const auto consume = [&](const bool is_attached_in_chunks) {
+        std::size_t previous_value = 0;
+        std::size_t local_popped_count = 0;
+        bool is_attached = false;
+        while (popped_count < NumberOfElements)
+        {
+            if (!is_attached)
+            {
+                ring.attach_consumer();
+                is_attached = true;
+            }
+
+            if (const auto value = ring.pop())
+            {
+                if (local_popped_count++ && *value <= previous_value)
+                    order_violation_count++;
+                previous_value = *value;
+                pop_counts[*value]++;
+                popped_count++;
+            }
+            else
+                std::this_thread::yield();
+
+            if (is_attached_in_chunks && local_popped_count % ChunkSize == ChunkSize - 1)
+            {
+                ring.detach_consumer();
+                is_attached = false;
+            }
+        }
+        if (is_attached)
+            ring.detach_consumer();
+    };
+
+    std::thread steady_consumer(consume, false);
+    std::thread intermittent_consumer(consume, true);
+
+    producer.join();
+    steady_consumer.join();
+    intermittent_consumer.join();
+
+    EXPECT_EQ(order_violation_count, 0u);
+    for (const auto &pop_count : pop_counts)
+        EXPECT_EQ(pop_count, 1u);
+}
+} // namespace AdaptiveProducerAdaptiveConsumerRingBufferTest
+} // namespace Iyp
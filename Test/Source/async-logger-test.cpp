@@ -0,0 +1,125 @@
+#include <Iyp/WaitFreeRingBufferUtilities/async-logger.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+
+namespace Iyp
+{
+namespace AsyncLoggerTest
+{
+std::string read_all(std::FILE *const file)
+{
+    std::rewind(file);
+    std::string content;
+    char chunk[4096];
+    std::size_t size;
+    while ((size = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+        content.append(chunk, size);
+    return content;
+}
+
+TEST(AsyncLoggerTest, ArgumentsAreFormattedInOrder)
+{
+    std::FILE *const file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    {
+        WaitFreeRingBufferUtilities::AsyncLogger<64> logger(file);
+        EXPECT_TRUE(logger.log("no arguments"));
+        EXPECT_TRUE(logger.log("{} {} {} {}", -42, std::uint64_t(42), 'x', true));
+        EXPECT_TRUE(logger.log("{} and {}", 0.5, "text"));
+        EXPECT_TRUE(logger.log("missing {} {}", 1));
+        EXPECT_EQ(logger.dropped_count(), 0u);
+    }
+
+    EXPECT_EQ(read_all(file), "no arguments\n"
+                              "-42 42 x true\n"
+                              "0.5 and text\n"
+                              "missing 1 {}\n");
+    std::fclose(file);
+}
+
+TEST(AsyncLoggerTest, DropsAreCountedAndReported)
+{
+    static constexpr std::size_t NumberOfRecords = 1 << 14;
+
+    std::FILE *const file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    std::size_t logged_count = 0;
+    std::size_t dropped_count = 0;
+    {
+        WaitFreeRingBufferUtilities::AsyncLogger<4> logger(file);
+        for (std::size_t i = 0; i < NumberOfRecords; i++)
+            logged_count += logger.log("record {}", i);
+        dropped_count = logger.dropped_count();
+    }
+    EXPECT_EQ(logged_count + dropped_count, NumberOfRecords);
+
+    std::istringstream lines(read_all(file));
+    std::string line;
+    std::size_t record_line_count = 0;
+    std::size_t reported_dropped_count = 0;
+    std::size_t previous_value = 0;
+    while (std::getline(lines, line))
+    {
+        std::size_t value;
+        if (std::sscanf(line.c_str(), "record %zu", &value) == 1)
+        {
+            EXPECT_TRUE(!record_line_count || value > previous_value);
+            previous_value = value;
+            record_line_count++;
+        }
+        else if (std::sscanf(line.c_str(), "AsyncLogger dropped %zu records", &value) == 1)
+            reported_dropped_count += value;
+        else
+            ADD_FAILURE() << line;
+    }
+    EXPECT_EQ(record_line_count, logged_count);
+    EXPECT_EQ(reported_dropped_count, dropped_count);
+    std::fclose(file);
+}
+
+TEST(AsyncLoggerTest, MultiProducerRecordsAreAllWritten)
+{
+    static constexpr std::size_t NumberOfProducerThreads = 4;
+    static constexpr std::size_t NumberOfRecordsPerThread = 4096;
+
+    std::FILE *const file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    {
+        WaitFreeRingBufferUtilities::AsyncLogger<256, 2, WaitFreeRingBufferUtilities::YieldWait> logger(file, 1024);
+
+        std::vector<std::thread> producers;
+        for (std::size_t thread_number = 0; thread_number < NumberOfProducerThreads; thread_number++)
+            producers.emplace_back([&logger, thread_number]() {
+                for (std::size_t i = 0; i < NumberOfRecordsPerThread; i++)
+                    while (!logger.log("{} {}", thread_number, i))
+                        std::this_thread::yield();
+            });
+
+        for (auto &producer : producers)
+            producer.join();
+    }
+
+    std::istringstream lines(read_all(file));
+    std::vector<std::size_t> next_values(NumberOfProducerThreads, 0);
+    std::size_t thread_number;
+    std::size_t value;
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        if (std::sscanf(line.c_str(), "%zu %zu", &thread_number, &value) != 2)
+            continue; // Drop reports from the retried pushes.
+        ASSERT_LT(thread_number, NumberOfProducerThreads);
+        EXPECT_EQ(value, next_values[thread_number]++);
+    }
+    for (const auto next_value : next_values)
+        EXPECT_EQ(next_value, NumberOfRecordsPerThread);
+    std::fclose(file);
+}
+} // namespace AsyncLoggerTest
+} // namespace Iyp
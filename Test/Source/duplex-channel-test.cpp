@@ -0,0 +1,204 @@
+#include <Iyp/WaitFreeRingBufferUtilities/duplex-channel.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+
+namespace Iyp
+{
+namespace DuplexChannelTest
+{
+static constexpr std::size_t Depth = 16;
+
+TEST(DuplexChannelTest, ResponsesAreMatchedByCorrelationId)
+{
+    WaitFreeRingBufferUtilities::DuplexChannel<std::size_t, std::size_t, Depth> channel;
+    using ChannelType = decltype(channel);
+
+    std::vector<std::uint64_t> correlation_ids(Depth);
+    std::set<std::uint64_t> distinct_ids;
+    for (std::size_t i = 0; i < Depth; i++)
+    {
+        correlation_ids[i] = channel.submit(i);
+        EXPECT_NE(correlation_ids[i], ChannelType::INVALID_CORRELATION_ID);
+        distinct_ids.insert(correlation_ids[i]);
+    }
+    EXPECT_EQ(distinct_ids.size(), Depth);
+    EXPECT_EQ(channel.submit(std::size_t(0)), ChannelType::INVALID_CORRELATION_ID);
+
+    EXPECT_EQ(channel.reap([](std::uint64_t, std::size_t &) { ADD_FAILURE(); }), 0u);
+    EXPECT_EQ(channel.serve([](std::size_t &request) { return request * 10; }, Depth / 2), Depth / 2);
+    EXPECT_EQ(channel.serve([](std::size_t &request) { return request * 10; }), Depth / 2);
+
+    std::size_t reaped_count = 0;
+    EXPECT_EQ(channel.reap([&](const std::uint64_t correlation_id, std::size_t &response) {
+        EXPECT_EQ(correlation_id, correlation_ids[reaped_count]);
+        EXPECT_EQ(response, reaped_count * 10);
+        reaped_count++;
+    }),
+              Depth);
+
+    // Reaped slots are reused, but their correlation ids are not.
+    const auto correlation_id = channel.submit(std::size_t(0));
+    EXPECT_NE(correlation_id, ChannelType::INVALID_CORRELATION_ID);
+    EXPECT_EQ(distinct_ids.count(correlation_id), 0u);
+}
+
+TEST(DuplexChannelTest, BatchesAreSubmittedAndPublishedTogether)
+{
+    WaitFreeRingBufferUtilities::DuplexChannel<std::size_t, std::size_t, Depth> channel;
+
+    std::vector<std::size_t> requests(Depth + 4);
+    for (std::size_t i = 0; i < requests.size(); i++)
+        requests[i] = i;
+    std::vector<std::uint64_t> correlation_ids(requests.size());
+    EXPECT_EQ(channel.submit_batch(requests.data(), requests.size(), correlation_ids.data()), Depth);
+    EXPECT_EQ(channel.submit_batch(requests.data(), 1, correlation_ids.data()), 0u);
+
+    // Nothing of a batch can be reaped before all of it has been served.
+    std::size_t handled_count = 0;
+    EXPECT_EQ(channel.serve([&](std::size_t &request) {
+        EXPECT_EQ(channel.reap([](std::uint64_t, std::size_t &) { ADD_FAILURE(); }), 0u);
+        handled_count++;
+        return request * 10;
+    }),
+              Depth);
+    EXPECT_EQ(handled_count, Depth);
+
+    std::size_t reaped_count = 0;
+    EXPECT_EQ(channel.reap([&](const std::uint64_t correlation_id, std::size_t &response) {
+        EXPECT_EQ(correlation_id, correlation_ids[reaped_count]);
+        EXPECT_EQ(response, reaped_count * 10);
+        reaped_count++;
+    }),
+              Depth);
+}
+
+TEST(DuplexChannelTest, ThrowingHandlerHandsItsSlotBack)
+{
+    const auto response = std::make_shared<int>(0);
+    WaitFreeRingBufferUtilities::DuplexChannel<int, std::shared_ptr<int>, Depth> channel;
+    for (std::size_t i = 0; i < Depth; i++)
+        EXPECT_NE(channel.submit(static_cast<int>(i)), decltype(channel)::INVALID_CORRELATION_ID);
+
+    const auto handle = [&response](int &request) {
+        if (request == 3)
+            throw std::runtime_error("request 3");
+        return response;
+    };
+    EXPECT_THROW(channel.serve(handle), std::runtime_error);
+
+    // The requests served before the throw are published, the failed one only gives its slot back.
+    std::size_t response_count = 0;
+    EXPECT_EQ(channel.reap([&response_count](std::uint64_t, std::shared_ptr<int> &) { response_count++; }), 4u);
+    EXPECT_EQ(response_count, 3u);
+    EXPECT_EQ(channel.serve(handle), Depth - 4);
+    EXPECT_EQ(channel.reap([](std::uint64_t, std::shared_ptr<int> &) {}), Depth - 4);
+    EXPECT_EQ(response.use_count(), 1);
+
+    for (std::size_t i = 0; i < Depth; i++)
+        EXPECT_NE(channel.submit(0), decltype(channel)::INVALID_CORRELATION_ID);
+}
+
+// Request whose move constructor throws once when armed, so that taking it off the submission ring fails.
+struct ThrowingMoveRequest
+{
+    static bool throws_on_move;
+    int value;
+
+    explicit ThrowingMoveRequest(const int i_value) : value(i_value)
+    {
+    }
+
+    ThrowingMoveRequest(const ThrowingMoveRequest &) = default;
+
+    ThrowingMoveRequest(ThrowingMoveRequest &&other) : value(other.value)
+    {
+        if (throws_on_move)
+        {
+            throws_on_move = false;
+            throw std::runtime_error("move");
+        }
+    }
+};
+
+bool ThrowingMoveRequest::throws_on_move = false;
+
+TEST(DuplexChannelTest, ThrowingSubmissionPopPublishesOnlyTheServedBatch)
+{
+    WaitFreeRingBufferUtilities::DuplexChannel<ThrowingMoveRequest, int, Depth> channel;
+    for (std::size_t i = 0; i < 4; i++)
+        EXPECT_NE(channel.submit(static_cast<int>(i)), decltype(channel)::INVALID_CORRELATION_ID);
+
+    const auto handle = [](ThrowingMoveRequest &request) {
+        if (request.value == 0)
+            ThrowingMoveRequest::throws_on_move = true;
+        return request.value * 10;
+    };
+    EXPECT_THROW(channel.serve(handle), std::runtime_error);
+
+    // Only the request served before the throw completes, the one that could not be taken stays queued.
+    std::vector<int> responses;
+    EXPECT_EQ(channel.reap([&responses](std::uint64_t, int &response) { responses.push_back(response); }), 1u);
+    EXPECT_EQ(channel.serve(handle), 3u);
+    EXPECT_EQ(channel.reap([&responses](std::uint64_t, int &response) { responses.push_back(response); }), 3u);
+    EXPECT_EQ(responses, (std::vector<int>{0, 10, 20, 30}));
+}
+
+TEST(DuplexChannelTest, UnreapedResponsesAreDestroyed)
+{
+    const auto response = std::make_shared<int>(0);
+    {
+        WaitFreeRingBufferUtilities::DuplexChannel<int, std::shared_ptr<int>, Depth> channel;
+        for (std::size_t i = 0; i < Depth; i++)
+            channel.submit(0);
+        channel.serve([&response](int &) { return response; });
+        EXPECT_EQ(response.use_count(), static_cast<long>(Depth + 1));
+
+        channel.reap([](std::uint64_t, std::shared_ptr<int> &) {}, Depth / 2);
+        EXPECT_EQ(response.use_count(), static_cast<long>(Depth / 2 + 1));
+    }
+    EXPECT_EQ(response.use_count(), 1);
+}
+
+TEST(DuplexChannelTest, ConcurrentRoundTrips)
+{
+    static constexpr std::size_t NumberOfRequests = 1 << 16;
+
+    WaitFreeRingBufferUtilities::DuplexChannel<std::size_t, std::size_t, Depth> channel;
+    std::atomic_bool should_stop{false};
+
+    std::thread server([&channel, &should_stop]() {
+        while (!should_stop)
+            if (!channel.serve([](std::size_t &request) { return request + 1; }, 4))
+                std::this_thread::yield();
+    });
+
+    std::size_t submitted_count = 0;
+    std::size_t reaped_count = 0;
+    std::size_t response_sum = 0;
+    while (reaped_count < NumberOfRequests)
+    {
+        while (submitted_count < NumberOfRequests &&
+               channel.submit(submitted_count) != decltype(channel)::INVALID_CORRELATION_ID)
+            submitted_count++;
+
+        const std::size_t count = channel.reap([&response_sum](std::uint64_t, std::size_t &response) { response_sum += response; }, 8);
+        if (!count)
+            std::this_thread::yield();
+        reaped_count += count;
+    }
+
+    should_stop = true;
+    server.join();
+
+    EXPECT_EQ(response_sum, NumberOfRequests * (NumberOfRequests + 1) / 2);
+    EXPECT_EQ(channel.reap([](std::uint64_t, std::size_t &) {}), 0u);
+}
+} // namespace DuplexChannelTest
+} // namespace Iyp
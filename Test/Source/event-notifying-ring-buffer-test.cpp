@@ -0,0 +1,123 @@
+#include <Iyp/WaitFreeRingBufferUtilities/event-notifying-ring-buffer.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <poll.h>
+#include <unistd.h>
+
+namespace Iyp
+{
+namespace EventNotifyingRingBufferTest
+{
+static constexpr std::size_t RingSize = 64;
+
+using TestRingBufferType = WaitFreeRingBufferUtilities::EventNotifyingRingBuffer<WaitFreeRingBufferUtilities::MultiProducer,
+                                                                                 WaitFreeRingBufferUtilities::SingleConsumer,
+                                                                                 std::size_t,
+                                                                                 RingSize>;
+
+bool is_readable(const int file_descriptor)
+{
+    pollfd poll_descriptor{file_descriptor, POLLIN, 0};
+    return ::poll(&poll_descriptor, 1, 0) == 1 && (poll_descriptor.revents & POLLIN);
+}
+
+std::uint64_t read_counter(const int file_descriptor)
+{
+    std::uint64_t counter = 0;
+    return ::read(file_descriptor, &counter, sizeof(counter)) == sizeof(counter) ? counter : 0;
+}
+
+TEST(EventNotifyingRingBufferTest, BurstOfPushesSignalsOnce)
+{
+    TestRingBufferType ring;
+    ASSERT_GE(ring.file_descriptor(), 0);
+    EXPECT_FALSE(is_readable(ring.file_descriptor()));
+
+    for (std::size_t i = 0; i < RingSize / 2; i++)
+        EXPECT_TRUE(ring.push(i));
+
+    EXPECT_TRUE(is_readable(ring.file_descriptor()));
+    EXPECT_EQ(read_counter(ring.file_descriptor()), 1u);
+
+    for (std::size_t i = RingSize / 2; i < RingSize; i++)
+        EXPECT_TRUE(ring.push(i));
+    EXPECT_FALSE(is_readable(ring.file_descriptor()));
+}
+
+TEST(EventNotifyingRingBufferTest, AcknowledgeRearmsTheNotifier)
+{
+    TestRingBufferType ring;
+
+    EXPECT_TRUE(ring.push(std::size_t(0)));
+    EXPECT_TRUE(is_readable(ring.file_descriptor()));
+
+    ring.acknowledge();
+    EXPECT_FALSE(is_readable(ring.file_descriptor()));
+    EXPECT_EQ(*ring.pop(), 0u);
+    EXPECT_FALSE(ring.pop());
+
+    EXPECT_TRUE(ring.push(std::size_t(1)));
+    EXPECT_TRUE(ring.push(std::size_t(2)));
+    EXPECT_TRUE(is_readable(ring.file_descriptor()));
+    EXPECT_EQ(read_counter(ring.file_descriptor()), 1u);
+}
+
+TEST(EventNotifyingRingBufferTest, EpollConsumerReceivesEveryElement)
+{
+    static constexpr std::size_t NumberOfPusherThreads = 2;
+    static constexpr std::size_t NumberOfElements = 1 << 14;
+
+    TestRingBufferType ring;
+
+    const int epoll_descriptor = ::epoll_create1(EPOLL_CLOEXEC);
+    ASSERT_GE(epoll_descriptor, 0);
+    epoll_event event{};
+    event.events = EPOLLIN;
+    ASSERT_EQ(::epoll_ctl(epoll_descriptor, EPOLL_CTL_ADD, ring.file_descriptor(), &event), 0);
+
+    std::vector<std::thread> pushers;
+    for (std::size_t thread_number = 0; thread_number < NumberOfPusherThreads; thread_number++)
+        pushers.emplace_back([&ring, thread_number]() {
+            for (std::size_t i = thread_number; i < NumberOfElements; i += NumberOfPusherThreads)
+            {
+                while (!ring.push(i))
+                    std::this_thread::yield();
+                if (i % 256 == thread_number)
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        });
+
+    std::vector<std::size_t> pop_counts(NumberOfElements, 0);
+    std::size_t popped_count = 0;
+    while (popped_count < NumberOfElements)
+    {
+        epoll_event ready_event;
+        ASSERT_EQ(::epoll_wait(epoll_descriptor, &ready_event, 1, 10000), 1);
+
+        ring.acknowledge();
+        while (auto result = ring.pop())
+        {
+            pop_counts[*result]++;
+            popped_count++;
+        }
+    }
+
+    for (auto &pusher : pushers)
+        pusher.join();
+    ::close(epoll_descriptor);
+
+    for (const auto pop_count : pop_counts)
+        EXPECT_EQ(pop_count, 1u);
+    EXPECT_FALSE(ring.pop());
+}
+} // namespace EventNotifyingRingBufferTest
+} // namespace Iyp
+#endif
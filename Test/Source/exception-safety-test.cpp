@@ -0,0 +1,203 @@
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <array>
+#include <thread>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+namespace Iyp
+{
+namespace ExceptionSafetyTest
+{
+static constexpr std::size_t RingSize = 16;
+static constexpr std::size_t NumberOfElements = 1 << 14;
+static constexpr std::size_t NumberOfProducerThreads = 4;
+
+// Throws when built from a value that is a multiple of ThrowingPeriod, so about one push in ThrowingPeriod fails.
+static constexpr std::size_t ThrowingPeriod = 3;
+
+struct ThrowingElement
+{
+    std::size_t value;
+
+    explicit ThrowingElement(const std::size_t i_value) : value(i_value)
+    {
+        if (value % ThrowingPeriod == 0)
+            throw std::runtime_error("ThrowingElement " + std::to_string(value));
+    }
+};
+
+static_assert(!WaitFreeRingBufferUtilities::Private::IsNothrowConstruction<WaitFreeRingBufferUtilities::DefaultPolicyConfiguration, ThrowingElement, std::size_t>::value,
+              "ThrowingElement should take the rollback path.");
+static_assert(WaitFreeRingBufferUtilities::Private::IsNothrowConstruction<WaitFreeRingBufferUtilities::DefaultPolicyConfiguration, std::size_t, std::size_t>::value,
+              "Scalars should keep the plain path.");
+
+// Pushes every value from every producer, counting the pushes that threw, while the consumers pop until each value that did not
+// throw has been popped.
+template <typename RingType>
+void push_and_pop_under_contention(RingType &ring, const std::size_t consumer_count)
+{
+    std::array<std::atomic_size_t, NumberOfElements> pop_counts;
+    for (auto &pop_count : pop_counts)
+        pop_count = 0;
+    std::atomic_size_t thrown_count{0};
+    std::atomic_size_t popped_count{0};
+    std::atomic_size_t running_producer_count{NumberOfProducerThreads};
+
+    std::vector<std::thread> threads;
+    for (std::size_t thread_number = 0; thread_number < NumberOfProducerThreads; thread_number++)
+        threads.emplace_back([&, thread_number]() {
+            for (std::size_t i = thread_number; i < NumberOfElements; i += NumberOfProducerThreads)
+            {
+                try
+                {
+                    while (!ring.push(i))
+                        std::this_thread::yield();
+                }
+                catch (const std::runtime_error &)
+                {
+                    thrown_count++;
+                }
+            }
+            running_producer_count--;
+        });
+
+    for (std::size_t thread_number = 0; thread_number < consumer_count; thread_number++)
+        threads.emplace_back([&]() {
+            while (running_producer_count || popped_count + thrown_count < NumberOfElements)
+            {
+                if (const auto element = ring.pop())
+                {
+                    pop_counts[element->value]++;
+                    popped_count++;
+                }
+                else
+                    std::this_thread::yield();
+            }
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_EQ(thrown_count, (NumberOfElements + ThrowingPeriod - 1) / ThrowingPeriod);
+    for (std::size_t i = 0; i < NumberOfElements; i++)
+        EXPECT_EQ(pop_counts[i], i % ThrowingPeriod ? 1u : 0u);
+    EXPECT_FALSE(ring.pop());
+
+    // No slot or credit was lost to the pushes that threw.
+    for (std::size_t i = 0; i < RingSize; i++)
+        EXPECT_TRUE(ring.push(std::size_t(1)));
+    EXPECT_FALSE(ring.push(std::size_t(1)));
+    for (std::size_t i = 0; i < RingSize; i++)
+        EXPECT_TRUE(ring.pop());
+    EXPECT_FALSE(ring.pop());
+}
+
+TEST(ExceptionSafetyTest, SingleProducerSingleConsumerPushThatThrowsLeavesTheRingUnchanged)
+{
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::SingleProducer,
+                                            WaitFreeRingBufferUtilities::SingleConsumer,
+                                            ThrowingElement,
+                                            RingSize>
+        ring;
+
+    for (std::size_t i = 0; i < 4 * RingSize; i++)
+        EXPECT_THROW(ring.push(std::size_t(0)), std::runtime_error);
+    for (std::size_t i = 0; i < RingSize; i++)
+        EXPECT_TRUE(ring.push(i * ThrowingPeriod + 1));
+    EXPECT_FALSE(ring.push(std::size_t(0))); // A full ring refuses the push before building the element.
+
+    for (std::size_t i = 0; i < RingSize; i++)
+        EXPECT_EQ(ring.pop()->value, i * ThrowingPeriod + 1);
+    EXPECT_FALSE(ring.pop());
+}
+
+TEST(ExceptionSafetyTest, MultiProducerMultiConsumerUnderContention)
+{
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::MultiProducer,
+                                            WaitFreeRingBufferUtilities::MultiConsumer,
+                                            ThrowingElement,
+                                            RingSize>
+        ring;
+    push_and_pop_under_contention(ring, 2);
+}
+
+TEST(ExceptionSafetyTest, MultiProducerSingleConsumerUnderContention)
+{
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::MultiProducer,
+                                            WaitFreeRingBufferUtilities::SingleConsumer,
+                                            ThrowingElement,
+                                            RingSize>
+        ring;
+    push_and_pop_under_contention(ring, 1);
+}
+
+TEST(ExceptionSafetyTest, OrderedMultiProducerMultiConsumerUnderContention)
+{
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::OrderedMultiProducer,
+                                            WaitFreeRingBufferUtilities::OrderedMultiConsumer,
+                                            ThrowingElement,
+                                            RingSize>
+        ring;
+    push_and_pop_under_contention(ring, 2);
+}
+
+// Without attached threads both sides take the exclusive path.
+TEST(ExceptionSafetyTest, AdaptiveRingStepsOverThrowingPushes)
+{
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::AdaptiveProducer,
+                                            WaitFreeRingBufferUtilities::AdaptiveConsumer,
+                                            ThrowingElement,
+                                            RingSize>
+        ring;
+
+    for (std::size_t try_index = 0; try_index < 4; try_index++)
+    {
+        EXPECT_THROW(ring.push(std::size_t(0)), std::runtime_error);
+        EXPECT_TRUE(ring.push(std::size_t(1)));
+        EXPECT_THROW(ring.push(std::size_t(3)), std::runtime_error);
+        EXPECT_THROW(ring.push(std::size_t(6)), std::runtime_error);
+        EXPECT_EQ(ring.pop()->value, 1u);
+        EXPECT_FALSE(ring.pop());
+    }
+
+    for (std::size_t i = 0; i < RingSize; i++)
+        EXPECT_TRUE(ring.push(i * ThrowingPeriod + 1));
+    EXPECT_FALSE(ring.push(std::size_t(1)));
+    for (std::size_t i = 0; i < RingSize; i++)
+        EXPECT_EQ(ring.pop()->value, i * ThrowingPeriod + 1);
+    EXPECT_FALSE(ring.pop());
+
+    // A throwing push must not leave the producer side exclusive, or attaching would wait for it forever.
+    EXPECT_THROW(ring.push(std::size_t(0)), std::runtime_error);
+    ring.attach_producer();
+    ring.attach_producer();
+    EXPECT_TRUE(ring.push(std::size_t(1)));
+    ring.detach_producer();
+    ring.detach_producer();
+    EXPECT_EQ(ring.pop()->value, 1u);
+}
+
+TEST(ExceptionSafetyTest, FrontStepsOverSlotsLeftByThrowingPushes)
+{
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::MultiProducer,
+                                            WaitFreeRingBufferUtilities::SingleConsumer,
+                                            ThrowingElement,
+                                            RingSize>
+        ring;
+
+    EXPECT_THROW(ring.push(std::size_t(0)), std::runtime_error);
+    EXPECT_THROW(ring.push(std::size_t(3)), std::runtime_error);
+    EXPECT_EQ(ring.front(), nullptr);
+
+    EXPECT_TRUE(ring.push(std::size_t(1)));
+    ASSERT_NE(ring.front(), nullptr);
+    EXPECT_EQ(ring.front()->value, 1u);
+    EXPECT_EQ(ring.pop()->value, 1u);
+    EXPECT_FALSE(ring.pop());
+}
+} // namespace ExceptionSafetyTest
+} // namespace Iyp
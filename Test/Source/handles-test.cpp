@@ -0,0 +1,170 @@
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <array>
+#include <thread>
+#include <atomic>
+
+namespace Iyp
+{
+namespace HandlesTest
+{
+static constexpr std::size_t RingSize = 1024;
+static constexpr std::size_t BatchSize = 32;
+static constexpr std::size_t NumberOfTries = 64;
+using McmpRingBufferType = WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::MultiProducer,
+                                                                   WaitFreeRingBufferUtilities::MultiConsumer,
+                                                                   std::size_t,
+                                                                   RingSize>;
+using ScmpRingBufferType = WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::MultiProducer,
+                                                                   WaitFreeRingBufferUtilities::SingleConsumer,
+                                                                   std::size_t,
+                                                                   RingSize>;
+
+TEST(HandlesTest, FlushReturnsUnusedCredits)
+{
+    McmpRingBufferType ring;
+
+    {
+        WaitFreeRingBufferUtilities::ProducerHandle<McmpRingBufferType> producer_handle{ring, BatchSize};
+        EXPECT_TRUE(producer_handle.push(0));
+    }
+
+    for (std::size_t i = 1; i < RingSize; i++)
+        EXPECT_TRUE(ring.push(i));
+    EXPECT_FALSE(ring.push(0));
+
+    {
+        WaitFreeRingBufferUtilities::ConsumerHandle<McmpRingBufferType> consumer_handle{ring, BatchSize};
+        EXPECT_TRUE(consumer_handle.pop());
+    }
+
+    for (std::size_t i = 1; i < RingSize; i++)
+        EXPECT_TRUE(ring.pop());
+    EXPECT_FALSE(ring.pop());
+}
+
+TEST(HandlesTest, HandlesRespectCapacity)
+{
+    McmpRingBufferType ring;
+    WaitFreeRingBufferUtilities::ProducerHandle<McmpRingBufferType> producer_handle{ring, BatchSize};
+    WaitFreeRingBufferUtilities::ConsumerHandle<McmpRingBufferType> consumer_handle{ring, BatchSize};
+
+    for (std::size_t try_index = 0; try_index < NumberOfTries; try_index++)
+    {
+        for (std::size_t i = 0; i < RingSize; i++)
+            EXPECT_TRUE(producer_handle.push(i));
+        EXPECT_FALSE(producer_handle.push(0));
+        EXPECT_FALSE(ring.push(0));
+
+        std::array<bool, RingSize> was_popped{};
+        for (std::size_t i = 0; i < RingSize; i++)
+        {
+            const auto pop_result = consumer_handle.pop();
+            ASSERT_TRUE(pop_result);
+            was_popped[*pop_result] = true;
+        }
+        EXPECT_FALSE(consumer_handle.pop());
+        EXPECT_FALSE(ring.pop());
+
+        for (const auto popped : was_popped)
+            EXPECT_TRUE(popped);
+    }
+}
+
+template <typename RingType, std::size_t NumberOfPopperThreads>
+void handles_push_pop_integrity()
+{
+    static constexpr std::size_t NumberOfPusherThreads = 4;
+
+    RingType ring;
+    std::array<std::atomic_size_t, RingSize> pop_counts;
+    for (auto &pop_count : pop_counts)
+        pop_count = 0;
+
+    std::vector<std::thread> threads;
+    for (std::size_t thread_number = 0; thread_number < NumberOfPopperThreads; thread_number++)
+        threads.emplace_back([&ring, &pop_counts]() {
+            for (std::size_t i = 0; i < RingSize * NumberOfTries / NumberOfPopperThreads;)
+            {
+                const auto popped_value = ring.pop();
+                if (popped_value)
+                {
+                    pop_counts[*popped_value].fetch_add(1, std::memory_order_relaxed);
+                    i++;
+                }
+            }
+        });
+
+    for (std::size_t thread_number = 0; thread_number < NumberOfPusherThreads; thread_number++)
+        threads.emplace_back([&ring]() {
+            WaitFreeRingBufferUtilities::ProducerHandle<RingType> producer_handle{ring, BatchSize};
+            for (std::size_t try_index = 0; try_index < NumberOfTries / NumberOfPusherThreads; try_index++)
+                for (std::size_t i = 0; i < RingSize;)
+                    if (producer_handle.push(i))
+                        i++;
+                    else
+                        std::this_thread::yield();
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+
+    for (const auto &pop_count : pop_counts)
+        EXPECT_EQ(pop_count, NumberOfTries);
+}
+
+TEST(HandlesTest, MultiProducerMultiConsumerProducerHandlesPushPopIntergrity)
+{
+    handles_push_pop_integrity<McmpRingBufferType, 2>();
+}
+
+TEST(HandlesTest, MultiProducerSingleConsumerProducerHandlesPushPopIntergrity)
+{
+    handles_push_pop_integrity<ScmpRingBufferType, 1>();
+}
+
+TEST(HandlesTest, MultiProducerMultiConsumerConsumerHandlesPushPopIntergrity)
+{
+    static constexpr std::size_t NumberOfPusherThreads = 2;
+    static constexpr std::size_t NumberOfPopperThreads = 4;
+
+    McmpRingBufferType ring;
+    std::array<std::atomic_size_t, RingSize> pop_counts;
+    for (auto &pop_count : pop_counts)
+        pop_count = 0;
+
+    std::vector<std::thread> threads;
+    for (std::size_t thread_number = 0; thread_number < NumberOfPopperThreads; thread_number++)
+        threads.emplace_back([&ring, &pop_counts]() {
+            WaitFreeRingBufferUtilities::ConsumerHandle<McmpRingBufferType> consumer_handle{ring, BatchSize};
+            for (std::size_t i = 0; i < RingSize * NumberOfTries / NumberOfPopperThreads;)
+            {
+                const auto popped_value = consumer_handle.pop();
+                if (popped_value)
+                {
+                    pop_counts[*popped_value].fetch_add(1, std::memory_order_relaxed);
+                    i++;
+                }
+                else
+                    std::this_thread::yield();
+            }
+        });
+
+    for (std::size_t thread_number = 0; thread_number < NumberOfPusherThreads; thread_number++)
+        threads.emplace_back([&ring]() {
+            for (std::size_t try_index = 0; try_index < NumberOfTries / NumberOfPusherThreads; try_index++)
+                for (std::size_t i = 0; i < RingSize;)
+                    if (ring.push(i))
+                        i++;
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+
+    for (const auto &pop_count : pop_counts)
+        EXPECT_EQ(pop_count, NumberOfTries);
+}
+} // namespace HandlesTest
+} // namespace Iyp
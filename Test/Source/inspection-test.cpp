@@ -0,0 +1,152 @@
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <array>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+
+namespace Iyp
+{
+namespace InspectionTest
+{
+static constexpr std::size_t RingSize = 8;
+
+using SpscRingBufferType = WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::SingleProducer,
+                                                                   WaitFreeRingBufferUtilities::SingleConsumer,
+                                                                   std::size_t,
+                                                                   RingSize>;
+
+TEST(InspectionTest, SnapshotKeepsQueueOrderAcrossTheWrapAround)
+{
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::OrderedMultiProducer,
+                                            WaitFreeRingBufferUtilities::OrderedMultiConsumer,
+                                            std::size_t,
+                                            RingSize>
+        ring;
+    EXPECT_TRUE(ring.snapshot().empty());
+
+    for (std::size_t i = 0; i < 6; i++)
+        EXPECT_TRUE(ring.push(i));
+    for (std::size_t i = 0; i < 6; i++)
+        EXPECT_TRUE(ring.pop());
+    for (std::size_t i = 10; i < 15; i++)
+        EXPECT_TRUE(ring.push(i));
+
+    const std::vector<std::size_t> expected{10, 11, 12, 13, 14};
+    EXPECT_EQ(ring.snapshot(), expected);
+    EXPECT_EQ(ring.snapshot(), expected);
+
+    for (const auto value : expected)
+        EXPECT_EQ(*ring.pop(), value);
+    EXPECT_TRUE(ring.snapshot().empty());
+}
+
+TEST(InspectionTest, SnapshotKeepsQueueOrderOfAFullWrappedRing)
+{
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::OrderedMultiProducer,
+                                            WaitFreeRingBufferUtilities::OrderedMultiConsumer,
+                                            std::size_t,
+                                            4>
+        ring;
+    for (std::size_t i = 0; i < 4; i++)
+        EXPECT_TRUE(ring.push(i));
+    EXPECT_EQ(*ring.pop(), 0u);
+    EXPECT_EQ(*ring.pop(), 1u);
+    EXPECT_TRUE(ring.push(std::size_t(4)));
+    EXPECT_TRUE(ring.push(std::size_t(5)));
+
+    const std::vector<std::size_t> expected{2, 3, 4, 5};
+    EXPECT_EQ(ring.snapshot(), expected);
+    for (const auto value : expected)
+        EXPECT_EQ(*ring.pop(), value);
+}
+
+TEST(InspectionTest, FrontPeeksWithoutPopping)
+{
+    SpscRingBufferType ring;
+    EXPECT_EQ(ring.front(), nullptr);
+
+    EXPECT_TRUE(ring.push(std::size_t(1)));
+    EXPECT_TRUE(ring.push(std::size_t(2)));
+
+    ASSERT_NE(ring.front(), nullptr);
+    EXPECT_EQ(*ring.front(), 1u);
+    *ring.front() = 3;
+
+    EXPECT_EQ(*ring.pop(), 3u);
+    EXPECT_EQ(*ring.front(), 2u);
+    EXPECT_EQ(*ring.pop(), 2u);
+    EXPECT_EQ(ring.front(), nullptr);
+}
+
+struct CheckedValue
+{
+    std::uint64_t value;
+    std::uint64_t complement;
+
+    explicit CheckedValue(const std::uint64_t i_value) : value(i_value), complement(~i_value)
+    {
+    }
+
+    bool is_intact() const
+    {
+        return complement == ~value;
+    }
+};
+
+TEST(InspectionTest, SnapshotsDoNotDisturbLiveTraffic)
+{
+    static constexpr std::size_t NumberOfElements = 1 << 16;
+    static constexpr std::size_t NumberOfPusherThreads = 2;
+    static constexpr std::size_t NumberOfPopperThreads = 2;
+
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::OrderedMultiProducer,
+                                            WaitFreeRingBufferUtilities::OrderedMultiConsumer,
+                                            CheckedValue,
+                                            64>
+        ring;
+    std::array<std::atomic_size_t, NumberOfElements> pop_counts;
+    for (auto &pop_count : pop_counts)
+        pop_count = 0;
+    std::atomic_size_t popped_count{0};
+    std::atomic_size_t torn_count{0};
+
+    std::vector<std::thread> threads;
+    threads.emplace_back([&]() {
+        while (popped_count < NumberOfElements)
+        {
+            for (const auto &element : ring.snapshot())
+                if (!element.is_intact() || element.value >= NumberOfElements)
+                    torn_count++;
+            std::this_thread::yield();
+        }
+    });
+
+    for (std::size_t thread_number = 0; thread_number < NumberOfPopperThreads; thread_number++)
+        threads.emplace_back([&]() {
+            for (std::size_t i = 0; i < NumberOfElements / NumberOfPopperThreads; i++)
+            {
+                const auto element = WaitFreeRingBufferUtilities::pop_wait<WaitFreeRingBufferUtilities::YieldWait>(ring);
+                pop_counts[element.value]++;
+                popped_count++;
+            }
+        });
+
+    for (std::size_t thread_number = 0; thread_number < NumberOfPusherThreads; thread_number++)
+        threads.emplace_back([&ring, thread_number]() {
+            for (std::size_t i = thread_number; i < NumberOfElements; i += NumberOfPusherThreads)
+                WaitFreeRingBufferUtilities::push_wait<WaitFreeRingBufferUtilities::YieldWait>(ring, i);
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_EQ(torn_count, 0u);
+    for (const auto &pop_count : pop_counts)
+        EXPECT_EQ(pop_count, 1u);
+    EXPECT_TRUE(ring.snapshot().empty());
+}
+} // namespace InspectionTest
+} // namespace Iyp
@@ -0,0 +1,234 @@
+#include <Iyp/WaitFreeRingBufferUtilities/journal-ring-buffer.inl>
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Iyp
+{
+namespace JournalRingBufferTest
+{
+static constexpr std::size_t RingSize = 64;
+
+struct Order
+{
+    std::uint64_t id;
+    double price;
+};
+
+using TestJournalType = WaitFreeRingBufferUtilities::JournalRingBuffer<Order, RingSize>;
+
+// Unique journal path that is removed when the test ends.
+class JournalPath
+{
+    std::string path;
+
+public:
+    JournalPath()
+    {
+        char name[] = "/tmp/journal-ring-buffer-test-XXXXXX";
+        const int file_descriptor = ::mkstemp(name);
+        if (file_descriptor >= 0)
+            ::close(file_descriptor);
+        path = name;
+    }
+
+    ~JournalPath()
+    {
+        std::remove(path.c_str());
+    }
+
+    const char *c_str() const
+    {
+        return path.c_str();
+    }
+};
+
+TEST(JournalRingBufferTest, PushAndPopAcrossTheWrapAround)
+{
+    const JournalPath path;
+    TestJournalType journal(path.c_str());
+    ASSERT_TRUE(journal.is_open());
+    EXPECT_EQ(journal.recovered_count(), 0u);
+    EXPECT_FALSE(journal.pop());
+
+    for (std::uint64_t try_index = 0; try_index < 4; try_index++)
+    {
+        std::vector<Order> orders;
+        for (std::uint64_t i = 0; i < RingSize; i++)
+            orders.push_back(Order{try_index * RingSize + i, 1.5});
+        EXPECT_EQ(journal.push_batch(orders.data(), RingSize / 2), RingSize / 2);
+        EXPECT_EQ(journal.push_batch(orders.data() + RingSize / 2, RingSize), RingSize / 2);
+        EXPECT_FALSE(journal.push(Order{0, 0.0}));
+
+        for (std::uint64_t i = 0; i < RingSize; i++)
+            EXPECT_EQ(journal.pop()->id, try_index * RingSize + i);
+        EXPECT_FALSE(journal.pop());
+    }
+}
+
+TEST(JournalRingBufferTest, UnpoppedElementsAreRecoveredOnReopen)
+{
+    const JournalPath path;
+    for (const auto flush_policy : {WaitFreeRingBufferUtilities::JournalFlushPolicy::NONE,
+                                    WaitFreeRingBufferUtilities::JournalFlushPolicy::PERIODIC,
+                                    WaitFreeRingBufferUtilities::JournalFlushPolicy::PER_BATCH})
+    {
+        {
+            TestJournalType journal(path.c_str(), flush_policy, std::chrono::milliseconds(1));
+            ASSERT_TRUE(journal.is_open());
+            for (std::uint64_t i = 0; i < 40; i++)
+                EXPECT_TRUE(journal.push(Order{i, 0.0}));
+            for (std::uint64_t i = 0; i < 30; i++)
+                EXPECT_EQ(journal.pop()->id, i);
+        }
+
+        TestJournalType journal(path.c_str(), flush_policy);
+        ASSERT_TRUE(journal.is_open());
+        EXPECT_EQ(journal.recovered_count(), 10u);
+        for (std::uint64_t i = 30; i < 40; i++)
+            EXPECT_EQ(journal.pop()->id, i);
+        EXPECT_FALSE(journal.pop());
+    }
+
+    // A journal of another shape is refused and left alone.
+    WaitFreeRingBufferUtilities::JournalRingBuffer<Order, RingSize * 2> larger_journal(path.c_str());
+    EXPECT_FALSE(larger_journal.is_open());
+    WaitFreeRingBufferUtilities::JournalRingBuffer<std::uint64_t, RingSize> other_element_journal(path.c_str());
+    EXPECT_FALSE(other_element_journal.is_open());
+    TestJournalType journal(path.c_str());
+    EXPECT_TRUE(journal.is_open());
+}
+
+TEST(JournalRingBufferTest, SlotsDoNotCrossPages)
+{
+    using SlotType = WaitFreeRingBufferUtilities::Private::JournalSlot<Order>;
+    EXPECT_EQ(4096 % sizeof(SlotType), 0u);
+    EXPECT_EQ(alignof(SlotType), sizeof(SlotType));
+}
+
+// The slots of a later round can reach the disk before the consumer cursor that allowed them, recovery should not stop there.
+TEST(JournalRingBufferTest, StaleConsumerCursorIsSkippedOver)
+{
+    const JournalPath path;
+    {
+        TestJournalType journal(path.c_str());
+        ASSERT_TRUE(journal.is_open());
+        for (std::uint64_t i = 0; i < RingSize; i++)
+            EXPECT_TRUE(journal.push(Order{i, 0.0}));
+        for (std::uint64_t i = 0; i < 48; i++)
+            EXPECT_EQ(journal.pop()->id, i);
+        for (std::uint64_t i = RingSize; i < RingSize + 40; i++)
+            EXPECT_TRUE(journal.push(Order{i, 0.0}));
+    }
+
+    {
+        using LayoutType = WaitFreeRingBufferUtilities::Private::JournalLayout<Order, RingSize>;
+        const int file_descriptor = ::open(path.c_str(), O_RDWR);
+        ASSERT_GE(file_descriptor, 0);
+        void *const memory = ::mmap(nullptr, sizeof(LayoutType), PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+        ASSERT_NE(memory, MAP_FAILED);
+        static_cast<LayoutType *>(memory)->consumer_cursor.store(0);
+        ::munmap(memory, sizeof(LayoutType));
+        ::close(file_descriptor);
+    }
+
+    // Ticket 64 in slot 0 means the consumer had passed ticket 0, and so on up to ticket 103 in slot 39. Nothing unpopped is lost,
+    // tickets 40 to 47 are popped a second time.
+    TestJournalType journal(path.c_str());
+    ASSERT_TRUE(journal.is_open());
+    EXPECT_EQ(journal.recovered_count(), RingSize);
+    for (std::uint64_t i = 40; i < RingSize + 40; i++)
+        EXPECT_EQ(journal.pop()->id, i);
+    EXPECT_FALSE(journal.pop());
+}
+
+struct FailingFileSync
+{
+    static std::atomic_bool should_fail;
+
+    static bool sync(void *const address, const std::size_t size)
+    {
+        return !should_fail && WaitFreeRingBufferUtilities::Private::MsyncFileSync::sync(address, size);
+    }
+};
+
+std::atomic_bool FailingFileSync::should_fail{false};
+
+TEST(JournalRingBufferTest, FailedSyncsAreReported)
+{
+    const JournalPath path;
+    WaitFreeRingBufferUtilities::JournalRingBuffer<Order, RingSize, FailingFileSync> journal(path.c_str(),
+                                                                                              WaitFreeRingBufferUtilities::JournalFlushPolicy::PER_BATCH);
+    ASSERT_TRUE(journal.is_open());
+
+    EXPECT_TRUE(journal.push(Order{0, 0.0}));
+    EXPECT_FALSE(journal.has_flush_failed());
+
+    FailingFileSync::should_fail = true;
+    EXPECT_TRUE(journal.push(Order{1, 0.0})); // Pushed, but not on disk.
+    EXPECT_TRUE(journal.has_flush_failed());
+    EXPECT_FALSE(journal.flush());
+
+    FailingFileSync::should_fail = false;
+    EXPECT_TRUE(journal.flush());
+    EXPECT_TRUE(journal.has_flush_failed()); // Stays set, the failed batch was not retried.
+    EXPECT_EQ(journal.pop()->id, 0u);
+    EXPECT_EQ(journal.pop()->id, 1u);
+}
+
+TEST(JournalRingBufferTest, ElementsSurviveAProcessDyingWithoutCleanup)
+{
+    static constexpr std::uint64_t NumberOfElements = 1 << 16;
+
+    const JournalPath path;
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        // The consumer falls behind and the process dies without running any destructor.
+        TestJournalType journal(path.c_str());
+        std::thread consumer([&journal]() {
+            for (std::uint64_t i = 0; i < NumberOfElements / 2;)
+                if (journal.pop())
+                    i++;
+                else
+                    std::this_thread::yield();
+        });
+        for (std::uint64_t i = 0; i < NumberOfElements;)
+            if (journal.push(Order{i, 0.0}))
+                i++;
+            else if (i >= NumberOfElements / 2 + RingSize)
+                break;
+            else
+                std::this_thread::yield();
+        consumer.join();
+        ::_exit(0);
+    }
+
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+
+    TestJournalType journal(path.c_str());
+    ASSERT_TRUE(journal.is_open());
+    EXPECT_EQ(journal.recovered_count(), RingSize);
+    for (std::uint64_t i = NumberOfElements / 2; i < NumberOfElements / 2 + RingSize; i++)
+        EXPECT_EQ(journal.pop()->id, i);
+    EXPECT_FALSE(journal.pop());
+
+    EXPECT_TRUE(journal.push(Order{NumberOfElements, 0.0}));
+    EXPECT_EQ(journal.pop()->id, NumberOfElements);
+}
+} // namespace JournalRingBufferTest
+} // namespace Iyp
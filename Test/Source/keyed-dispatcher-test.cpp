@@ -0,0 +1,147 @@
+#include <Iyp/WaitFreeRingBufferUtilities/keyed-dispatcher.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/details/aligned-allocation.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <array>
+#include <thread>
+#include <atomic>
+
+namespace Iyp
+{
+namespace KeyedDispatcherTest
+{
+static constexpr std::size_t LaneCount = 3;
+static constexpr std::size_t LaneSize = 64;
+static constexpr std::size_t BucketCount = 32;
+
+struct IdentityHash
+{
+    std::size_t operator()(const std::size_t key) const
+    {
+        return key;
+    }
+};
+
+using TestDispatcherType = WaitFreeRingBufferUtilities::KeyedDispatcher<std::size_t, std::size_t, LaneCount, LaneSize, BucketCount, IdentityHash>;
+
+TEST(KeyedDispatcherTest, StatisticsTrackOccupancyAndProcessedCount)
+{
+    const auto dispatcher = WaitFreeRingBufferUtilities::Details::make_aligned_unique<TestDispatcherType>();
+
+    for (std::size_t key = 0; key < BucketCount; key++)
+        EXPECT_EQ(dispatcher->lane_of(key), key % LaneCount);
+
+    for (std::size_t i = 0; i < LaneSize; i++)
+        EXPECT_TRUE(dispatcher->push(std::size_t(0), i));
+    EXPECT_FALSE(dispatcher->push(std::size_t(LaneCount), std::size_t(0)));
+    EXPECT_TRUE(dispatcher->push(std::size_t(1), std::size_t(0)));
+
+    auto statistics = dispatcher->statistics();
+    EXPECT_EQ(statistics[0].occupancy, LaneSize);
+    EXPECT_EQ(statistics[1].occupancy, 1u);
+    EXPECT_EQ(statistics[2].occupancy, 0u);
+    EXPECT_EQ(statistics[0].bucket_count + statistics[1].bucket_count + statistics[2].bucket_count, BucketCount);
+
+    std::size_t next_value = 0;
+    while (dispatcher->consume(0, [&next_value](const std::size_t key, std::size_t &value) {
+        EXPECT_EQ(key, 0u);
+        EXPECT_EQ(value, next_value++);
+    }))
+    {
+    }
+    EXPECT_EQ(next_value, LaneSize);
+
+    statistics = dispatcher->statistics();
+    EXPECT_EQ(statistics[0].occupancy, 0u);
+    EXPECT_EQ(statistics[0].processed_count, LaneSize);
+    EXPECT_EQ(statistics[1].processed_count, 0u);
+}
+
+TEST(KeyedDispatcherTest, RebalanceMovesOnlyIdleBucketsOffTheBusiestLane)
+{
+    const auto dispatcher = WaitFreeRingBufferUtilities::Details::make_aligned_unique<TestDispatcherType>();
+    const auto consume_all = [&dispatcher](const std::size_t lane) {
+        while (dispatcher->consume(lane, [](const std::size_t, std::size_t &) {}))
+        {
+        }
+    };
+
+    // Lane 0 gets two busy keys, the other lanes stay idle.
+    for (std::size_t i = 0; i < 8; i++)
+    {
+        EXPECT_TRUE(dispatcher->push(std::size_t(0), i));
+        EXPECT_TRUE(dispatcher->push(std::size_t(LaneCount), i));
+    }
+    consume_all(0);
+
+    // A bucket with a message in flight is never moved.
+    EXPECT_TRUE(dispatcher->push(std::size_t(0), std::size_t(0)));
+    EXPECT_EQ(dispatcher->rebalance(), 1u);
+    EXPECT_EQ(dispatcher->lane_of(0), 0u);
+    EXPECT_NE(dispatcher->lane_of(LaneCount), 0u);
+
+    consume_all(0);
+    EXPECT_EQ(dispatcher->rebalance(), 0u);
+
+    const auto statistics = dispatcher->statistics();
+    EXPECT_EQ(statistics[0].bucket_count, BucketCount / LaneCount);
+}
+
+TEST(KeyedDispatcherTest, PerKeyOrderIsKeptWhileRebalancing)
+{
+    static constexpr std::size_t NumberOfProducerThreads = 2;
+    static constexpr std::size_t NumberOfKeysPerProducer = 8;
+    static constexpr std::size_t NumberOfMessagesPerKey = 1024;
+    static constexpr std::size_t NumberOfKeys = NumberOfProducerThreads * NumberOfKeysPerProducer;
+
+    const auto dispatcher = WaitFreeRingBufferUtilities::Details::make_aligned_unique<TestDispatcherType>();
+    std::array<std::size_t, NumberOfKeys> next_values{};
+    std::atomic_size_t consumed_count{0};
+    std::atomic_size_t order_violation_count{0};
+    std::atomic_bool should_stop{false};
+
+    std::vector<std::thread> threads;
+    for (std::size_t lane = 0; lane < LaneCount; lane++)
+        threads.emplace_back([&, lane]() {
+            while (consumed_count < NumberOfKeys * NumberOfMessagesPerKey)
+                if (dispatcher->consume(lane, [&](const std::size_t key, std::size_t &value) {
+                        // Only one consumer handles a key at a time, so the expected value needs no synchronization.
+                        if (next_values[key]++ != value)
+                            order_violation_count++;
+                    }))
+                    consumed_count++;
+                else
+                    std::this_thread::yield();
+        });
+
+    threads.emplace_back([&]() {
+        while (!should_stop)
+        {
+            dispatcher->rebalance();
+            std::this_thread::yield();
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (std::size_t thread_number = 0; thread_number < NumberOfProducerThreads; thread_number++)
+        producers.emplace_back([&, thread_number]() {
+            for (std::size_t value = 0; value < NumberOfMessagesPerKey; value++)
+                for (std::size_t key = thread_number; key < NumberOfKeys; key += NumberOfProducerThreads)
+                    while (!dispatcher->push(key, value))
+                        std::this_thread::yield();
+        });
+
+    for (auto &producer : producers)
+        producer.join();
+    for (std::size_t i = 0; i < LaneCount; i++)
+        threads[i].join();
+    should_stop = true;
+    threads.back().join();
+
+    EXPECT_EQ(order_violation_count, 0u);
+    for (const auto next_value : next_values)
+        EXPECT_EQ(next_value, NumberOfMessagesPerKey);
+}
+} // namespace KeyedDispatcherTest
+} // namespace Iyp
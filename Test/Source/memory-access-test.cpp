@@ -0,0 +1,130 @@
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <array>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+namespace Iyp
+{
+namespace MemoryAccessTest
+{
+static constexpr std::size_t RingSize = 64;
+static constexpr std::size_t NumberOfElements = 4096;
+
+using Configuration = WaitFreeRingBufferUtilities::PolicyConfiguration<WaitFreeRingBufferUtilities::BusySpinWait, 4, 256>;
+using Policies = WaitFreeRingBufferUtilities::ConfiguredPolicies<Configuration>;
+
+struct LargeMessage
+{
+    std::array<std::uint64_t, 64> values;
+
+    LargeMessage() = default;
+
+    explicit LargeMessage(const std::uint64_t value)
+    {
+        values.fill(value);
+    }
+
+    bool is_intact() const
+    {
+        for (const auto value : values)
+            if (value != values[0])
+                return false;
+        return true;
+    }
+};
+
+static_assert(WaitFreeRingBufferUtilities::Private::UsesStreamingStore<Configuration, LargeMessage, const LargeMessage &>::value,
+              "Copies of large trivially copyable elements should be streamed.");
+static_assert(!WaitFreeRingBufferUtilities::Private::UsesStreamingStore<Configuration, LargeMessage, std::uint64_t>::value,
+              "Elements built from other arguments should be constructed in place.");
+static_assert(!WaitFreeRingBufferUtilities::Private::UsesStreamingStore<Configuration, std::uint64_t, std::uint64_t>::value,
+              "Elements below the threshold should be constructed in place.");
+static_assert(!WaitFreeRingBufferUtilities::Private::UsesStreamingStore<Configuration, std::vector<LargeMessage>, std::vector<LargeMessage>>::value,
+              "Elements that are not trivially copyable should be constructed in place.");
+
+TEST(MemoryAccessTest, StreamingCopyAtEveryAlignment)
+{
+    std::array<unsigned char, 1024> source;
+    for (std::size_t i = 0; i < source.size(); i++)
+        source[i] = static_cast<unsigned char>(i * 7);
+
+    for (std::size_t offset = 0; offset < 32; offset++)
+        for (const std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(15), std::size_t(16), std::size_t(33), std::size_t(512), std::size_t(960)})
+        {
+            alignas(64) std::array<unsigned char, 1024> destination{};
+            WaitFreeRingBufferUtilities::Details::streaming_copy(destination.data() + offset, source.data(), size);
+            EXPECT_EQ(std::memcmp(destination.data() + offset, source.data(), size), 0);
+            for (std::size_t i = 0; i < offset; i++)
+                EXPECT_EQ(destination[i], 0u);
+            for (std::size_t i = offset + size; i < destination.size(); i++)
+                EXPECT_EQ(destination[i], 0u);
+        }
+}
+
+TEST(MemoryAccessTest, SingleProducerSingleConsumerOrderedPushPop)
+{
+    WaitFreeRingBufferUtilities::RingBuffer<Policies::SingleProducer, Policies::SingleConsumer, LargeMessage, RingSize> ring;
+
+    for (std::size_t try_index = 0; try_index < 16; try_index++)
+    {
+        for (std::size_t i = 0; i < RingSize; i++)
+        {
+            const LargeMessage message(try_index * RingSize + i);
+            EXPECT_TRUE(i % 2 ? ring.push(message) : ring.push(try_index * RingSize + i));
+        }
+        EXPECT_FALSE(ring.push(LargeMessage(0)));
+
+        for (std::size_t i = 0; i < RingSize; i++)
+        {
+            const auto message = ring.pop();
+            EXPECT_TRUE(message->is_intact());
+            EXPECT_EQ(message->values[0], try_index * RingSize + i);
+        }
+        EXPECT_FALSE(ring.pop());
+    }
+}
+
+TEST(MemoryAccessTest, MultiProducerMultiConsumerPushPopIntegrity)
+{
+    static constexpr std::size_t NumberOfPusherThreads = 2;
+    static constexpr std::size_t NumberOfPopperThreads = 2;
+
+    WaitFreeRingBufferUtilities::RingBuffer<Policies::MultiProducer, Policies::MultiConsumer, LargeMessage, RingSize> ring;
+    std::array<std::atomic_size_t, NumberOfElements> pop_counts;
+    for (auto &pop_count : pop_counts)
+        pop_count = 0;
+
+    std::vector<std::thread> threads;
+    for (std::size_t thread_number = 0; thread_number < NumberOfPopperThreads; thread_number++)
+        threads.emplace_back([&ring, &pop_counts]() {
+            for (std::size_t i = 0; i < NumberOfElements / NumberOfPopperThreads; i++)
+            {
+                const auto message = WaitFreeRingBufferUtilities::pop_wait<WaitFreeRingBufferUtilities::YieldWait>(ring);
+                EXPECT_TRUE(message.is_intact());
+                pop_counts[message.values[0]]++;
+            }
+        });
+
+    for (std::size_t thread_number = 0; thread_number < NumberOfPusherThreads; thread_number++)
+        threads.emplace_back([&ring, thread_number]() {
+            for (std::size_t i = thread_number; i < NumberOfElements; i += NumberOfPusherThreads)
+            {
+                const LargeMessage message(i);
+                WaitFreeRingBufferUtilities::push_wait<WaitFreeRingBufferUtilities::YieldWait>(ring, message);
+            }
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+
+    for (const auto &pop_count : pop_counts)
+        EXPECT_EQ(pop_count, 1u);
+    EXPECT_FALSE(ring.pop());
+}
+} // namespace MemoryAccessTest
+} // namespace Iyp
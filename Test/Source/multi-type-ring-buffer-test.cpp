@@ -0,0 +1,200 @@
+#include <Iyp/WaitFreeRingBufferUtilities/multi-type-ring-buffer.inl>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <cstdint>
+
+namespace Iyp
+{
+namespace MultiTypeRingBufferTest
+{
+static constexpr std::size_t RingCapacity = 4096;
+static constexpr std::size_t NumberOfTries = 1024;
+
+struct SmallMessage
+{
+    std::uint32_t value;
+};
+
+struct LargeMessage
+{
+    std::array<std::uint64_t, 32> values;
+};
+
+struct CountedMessage
+{
+    static std::atomic_int live_count;
+    std::string text;
+
+    explicit CountedMessage(std::string i_text) : text(std::move(i_text)) { live_count++; }
+    CountedMessage(const CountedMessage &other) : text(other.text) { live_count++; }
+    ~CountedMessage() { live_count--; }
+};
+
+std::atomic_int CountedMessage::live_count{0};
+
+using TestRingBufferType = WaitFreeRingBufferUtilities::MultiTypeRingBuffer<RingCapacity, SmallMessage, LargeMessage, CountedMessage>;
+
+struct SequenceVisitor
+{
+    std::size_t next_value{0};
+    std::size_t mismatch_count{0};
+
+    void check(const std::size_t value)
+    {
+        if (value != next_value)
+            mismatch_count++;
+        next_value++;
+    }
+
+    void operator()(SmallMessage &message) { check(message.value); }
+    void operator()(LargeMessage &message) { check(message.values[31]); }
+    void operator()(CountedMessage &message) { check(std::stoul(message.text)); }
+};
+
+bool push_message(TestRingBufferType &ring, const std::size_t value)
+{
+    switch (value % 3)
+    {
+    case 0:
+        return ring.push<SmallMessage>(SmallMessage{static_cast<std::uint32_t>(value)});
+    case 1:
+    {
+        LargeMessage message;
+        message.values[31] = value;
+        return ring.push<LargeMessage>(message);
+    }
+    default:
+        return ring.push<CountedMessage>(std::to_string(value));
+    }
+}
+
+TEST(MultiTypeRingBufferTest, EmptyAndFullRingTest)
+{
+    TestRingBufferType ring;
+    SequenceVisitor visitor;
+
+    EXPECT_FALSE(ring.pop(visitor));
+
+    std::size_t small_message_count = 0;
+    while (ring.push<SmallMessage>(SmallMessage{static_cast<std::uint32_t>(small_message_count)}))
+        small_message_count++;
+
+    EXPECT_EQ(small_message_count, RingCapacity / 16);
+    EXPECT_FALSE(ring.push<LargeMessage>(LargeMessage{}));
+
+    for (std::size_t i = 0; i < small_message_count; i++)
+        EXPECT_TRUE(ring.pop(visitor));
+
+    EXPECT_FALSE(ring.pop(visitor));
+    EXPECT_EQ(visitor.mismatch_count, 0u);
+}
+
+TEST(MultiTypeRingBufferTest, OrderedPushPopWithWrapAround)
+{
+    TestRingBufferType ring;
+    SequenceVisitor visitor;
+    std::size_t value = 0;
+
+    for (std::size_t try_index = 0; try_index < NumberOfTries; try_index++)
+    {
+        std::size_t pushed_count = 0;
+        while (push_message(ring, value))
+        {
+            value++;
+            pushed_count++;
+        }
+
+        for (std::size_t i = 0; i < pushed_count; i++)
+            EXPECT_TRUE(ring.pop(visitor));
+        EXPECT_FALSE(ring.pop(visitor));
+    }
+
+    EXPECT_EQ(visitor.next_value, value);
+    EXPECT_EQ(visitor.mismatch_count, 0u);
+    EXPECT_EQ(CountedMessage::live_count, 0);
+}
+
+struct alignas(128) OverAlignedMessage
+{
+    std::uint32_t value;
+};
+
+struct AlignmentVisitor
+{
+    std::size_t misaligned_count{0};
+
+    void operator()(SmallMessage &) {}
+    void operator()(OverAlignedMessage &message)
+    {
+        if (reinterpret_cast<std::uintptr_t>(&message) % alignof(OverAlignedMessage))
+            misaligned_count++;
+    }
+};
+
+TEST(MultiTypeRingBufferTest, MessagesMoreAlignedThanACacheLine)
+{
+    // Only a cache line past a 128 byte boundary, unless the ring itself asks for the alignment of its messages.
+    struct alignas(128) OffsetRing
+    {
+        unsigned char padding[64];
+        WaitFreeRingBufferUtilities::MultiTypeRingBuffer<RingCapacity, SmallMessage, OverAlignedMessage> ring;
+    } offset_ring;
+    auto &ring = offset_ring.ring;
+    AlignmentVisitor visitor;
+
+    for (std::size_t try_index = 0; try_index < NumberOfTries; try_index++)
+    {
+        EXPECT_TRUE(ring.push<SmallMessage>(SmallMessage{0}));
+        EXPECT_TRUE(ring.push<OverAlignedMessage>(OverAlignedMessage{0}));
+        EXPECT_TRUE(ring.pop(visitor));
+        EXPECT_TRUE(ring.pop(visitor));
+    }
+
+    EXPECT_EQ(visitor.misaligned_count, 0u);
+}
+
+TEST(MultiTypeRingBufferTest, DestructorDestroysRemainingMessages)
+{
+    {
+        TestRingBufferType ring;
+        for (std::size_t value = 0; push_message(ring, value); value++)
+        {
+        }
+        EXPECT_GT(CountedMessage::live_count, 0);
+    }
+
+    EXPECT_EQ(CountedMessage::live_count, 0);
+}
+
+TEST(MultiTypeRingBufferTest, SingleProducerSingleConsumerPushPopIntergrityAndOrder)
+{
+    static constexpr std::size_t NumberOfMessages = RingCapacity * 16;
+
+    TestRingBufferType ring;
+    SequenceVisitor visitor;
+
+    std::thread popper([&ring, &visitor]() {
+        for (std::size_t i = 0; i < NumberOfMessages;)
+            if (ring.pop(visitor))
+                i++;
+    });
+
+    std::thread pusher([&ring]() {
+        for (std::size_t i = 0; i < NumberOfMessages;)
+            if (push_message(ring, i))
+                i++;
+    });
+
+    pusher.join();
+    popper.join();
+
+    EXPECT_EQ(visitor.next_value, NumberOfMessages);
+    EXPECT_EQ(visitor.mismatch_count, 0u);
+    EXPECT_EQ(CountedMessage::live_count, 0);
+}
+} // namespace MultiTypeRingBufferTest
+} // namespace Iyp
@@ -0,0 +1,180 @@
+#include <Iyp/WaitFreeRingBufferUtilities/object-pool.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <array>
+#include <thread>
+#include <atomic>
+#include <memory>
+
+namespace Iyp
+{
+namespace ObjectPoolTest
+{
+static constexpr std::size_t PoolSize = 64;
+
+struct CountedObject
+{
+    static std::atomic_int live_count;
+    std::size_t value;
+
+    explicit CountedObject(const std::size_t i_value) : value(i_value) { live_count++; }
+    CountedObject(const CountedObject &other) : value(other.value) { live_count++; }
+    ~CountedObject() { live_count--; }
+};
+
+std::atomic_int CountedObject::live_count{0};
+
+using TestPoolType = WaitFreeRingBufferUtilities::ObjectPool<CountedObject, PoolSize>;
+
+TEST(ObjectPoolTest, ObjectsAreConstructedOnceAndReused)
+{
+    {
+        TestPoolType pool(std::size_t(7));
+        EXPECT_EQ(CountedObject::live_count, static_cast<int>(PoolSize));
+
+        std::vector<TestPoolType::Handle> handles;
+        for (std::size_t i = 0; i < PoolSize; i++)
+        {
+            handles.push_back(pool.acquire());
+            ASSERT_TRUE(handles.back());
+            EXPECT_EQ(handles.back()->value, 7u);
+            handles.back()->value = i;
+        }
+        EXPECT_FALSE(pool.acquire());
+
+        handles.pop_back();
+        auto handle = pool.acquire();
+        ASSERT_TRUE(handle);
+        EXPECT_EQ(handle->value, PoolSize - 1);
+
+        handle.reset();
+        EXPECT_FALSE(handle);
+        EXPECT_EQ(handle.get(), nullptr);
+        EXPECT_TRUE(pool.acquire());
+        EXPECT_EQ(CountedObject::live_count, static_cast<int>(PoolSize));
+    }
+
+    EXPECT_EQ(CountedObject::live_count, 0);
+}
+
+TEST(ObjectPoolTest, MovedHandlesReleaseOnce)
+{
+    TestPoolType pool(std::size_t(0));
+
+    auto first = pool.acquire();
+    auto second = std::move(first);
+    EXPECT_FALSE(first);
+    EXPECT_TRUE(second);
+
+    first = pool.acquire();
+    first = std::move(second);
+    EXPECT_FALSE(second);
+
+    std::size_t free_count = 0;
+    std::vector<TestPoolType::Handle> handles;
+    for (auto handle = pool.acquire(); handle; handle = pool.acquire())
+    {
+        handles.push_back(std::move(handle));
+        free_count++;
+    }
+    EXPECT_EQ(free_count, PoolSize - 1);
+}
+
+TEST(ObjectPoolTest, CacheKeepsReleasedObjectsLocal)
+{
+    TestPoolType pool(std::size_t(0));
+
+    {
+        WaitFreeRingBufferUtilities::ObjectPoolCache<TestPoolType, 8> cache(pool);
+
+        auto handle = cache.acquire();
+        ASSERT_TRUE(handle);
+        CountedObject *const object = handle.get();
+        cache.release(std::move(handle));
+        EXPECT_FALSE(handle);
+        EXPECT_EQ(cache.acquire().get(), object);
+
+        std::vector<TestPoolType::Handle> handles;
+        for (auto handle = cache.acquire(); handle; handle = cache.acquire())
+            handles.push_back(std::move(handle));
+        EXPECT_EQ(handles.size(), PoolSize);
+
+        for (auto &handle : handles)
+            cache.release(std::move(handle));
+
+        std::size_t shared_free_count = 0;
+        std::vector<TestPoolType::Handle> shared_handles;
+        for (auto handle = pool.acquire(); handle; handle = pool.acquire())
+        {
+            shared_handles.push_back(std::move(handle));
+            shared_free_count++;
+        }
+        EXPECT_GE(shared_free_count, PoolSize - 8);
+        EXPECT_LT(shared_free_count, PoolSize);
+    }
+
+    std::size_t free_count = 0;
+    std::vector<TestPoolType::Handle> handles;
+    for (auto handle = pool.acquire(); handle; handle = pool.acquire())
+    {
+        handles.push_back(std::move(handle));
+        free_count++;
+    }
+    EXPECT_EQ(free_count, PoolSize);
+}
+
+TEST(ObjectPoolTest, HandlesPassedThroughARingAreNeverShared)
+{
+    static constexpr std::size_t NumberOfProducerThreads = 2;
+    static constexpr std::size_t NumberOfConsumerThreads = 2;
+    static constexpr std::size_t NumberOfElements = 1 << 14;
+
+    TestPoolType pool(std::size_t(0));
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::MultiProducer,
+                                            WaitFreeRingBufferUtilities::MultiConsumer,
+                                            TestPoolType::Handle,
+                                            PoolSize / 2>
+        ring;
+    std::array<std::atomic_size_t, NumberOfElements> pop_counts;
+    for (auto &pop_count : pop_counts)
+        pop_count = 0;
+
+    std::vector<std::thread> threads;
+    for (std::size_t thread_number = 0; thread_number < NumberOfConsumerThreads; thread_number++)
+        threads.emplace_back([&pool, &ring, &pop_counts]() {
+            WaitFreeRingBufferUtilities::ObjectPoolCache<TestPoolType, 4> cache(pool);
+            for (std::size_t i = 0; i < NumberOfElements / NumberOfConsumerThreads; i++)
+            {
+                auto handle = WaitFreeRingBufferUtilities::pop_wait<WaitFreeRingBufferUtilities::YieldWait>(ring);
+                pop_counts[handle->value]++;
+                cache.release(std::move(handle));
+            }
+        });
+
+    for (std::size_t thread_number = 0; thread_number < NumberOfProducerThreads; thread_number++)
+        threads.emplace_back([&pool, &ring, thread_number]() {
+            WaitFreeRingBufferUtilities::ObjectPoolCache<TestPoolType, 4> cache(pool);
+            for (std::size_t i = thread_number; i < NumberOfElements; i += NumberOfProducerThreads)
+            {
+                auto handle = cache.acquire();
+                while (!handle)
+                {
+                    std::this_thread::yield();
+                    handle = cache.acquire();
+                }
+
+                handle->value = i;
+                WaitFreeRingBufferUtilities::push_wait<WaitFreeRingBufferUtilities::YieldWait>(ring, std::move(handle));
+            }
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+
+    for (const auto &pop_count : pop_counts)
+        EXPECT_EQ(pop_count, 1u);
+}
+} // namespace ObjectPoolTest
+} // namespace Iyp
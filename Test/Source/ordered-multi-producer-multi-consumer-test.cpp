@@ -0,0 +1,183 @@
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <array>
+#include <thread>
+#include <atomic>
+#include <memory>
+
+namespace Iyp
+{
+namespace OrderedMultiProducerMultiConsumerRingBufferTest
+{
+static constexpr std::size_t RingSize = 64;
+static constexpr std::size_t NumberOfTries = 256;
+static constexpr std::size_t NumberOfElements = 1 << 14;
+
+using TestRingBufferType = WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::OrderedMultiProducer,
+                                                                   WaitFreeRingBufferUtilities::OrderedMultiConsumer,
+                                                                   std::size_t,
+                                                                   RingSize>;
+
+TEST(OrderedMultiProducerMultiConsumerRingBufferTest, EmptyAndFullRingTest)
+{
+    TestRingBufferType ring;
+
+    EXPECT_FALSE(ring.pop());
+
+    for (std::size_t try_index = 0; try_index < NumberOfTries; try_index++)
+    {
+        for (std::size_t i = 0; i < RingSize; i++)
+            EXPECT_TRUE(ring.push(i));
+
+        EXPECT_FALSE(ring.push(0));
+
+        for (std::size_t i = 0; i < RingSize; i++)
+            EXPECT_EQ(*ring.pop(), i);
+
+        EXPECT_FALSE(ring.pop());
+    }
+}
+
+// Two slots is the smallest ring the sequences can tell apart, a push must not see an unpopped slot as free.
+TEST(OrderedMultiProducerMultiConsumerRingBufferTest, SmallestRingDoesNotOverwriteUnpoppedElements)
+{
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::OrderedMultiProducer,
+                                            WaitFreeRingBufferUtilities::OrderedMultiConsumer,
+                                            std::size_t,
+                                            2>
+        ring;
+
+    for (std::size_t try_index = 0; try_index < NumberOfTries; try_index++)
+    {
+        EXPECT_TRUE(ring.push(2 * try_index));
+        EXPECT_TRUE(ring.push(2 * try_index + 1));
+        EXPECT_FALSE(ring.push(std::size_t(0)));
+
+        EXPECT_EQ(*ring.pop(), 2 * try_index);
+        EXPECT_TRUE(ring.push(std::size_t(0)));
+        EXPECT_FALSE(ring.push(std::size_t(0)));
+        EXPECT_EQ(*ring.pop(), 2 * try_index + 1);
+        EXPECT_EQ(*ring.pop(), 0u);
+        EXPECT_FALSE(ring.pop());
+    }
+}
+
+TEST(OrderedMultiProducerMultiConsumerRingBufferTest, DestructorDestroysRemainingElements)
+{
+    auto counter = std::make_shared<int>(0);
+    {
+        WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::OrderedMultiProducer,
+                                                WaitFreeRingBufferUtilities::OrderedMultiConsumer,
+                                                std::shared_ptr<int>,
+                                                RingSize>
+            ring;
+
+        for (std::size_t i = 0; i < RingSize; i++)
+            EXPECT_TRUE(ring.push(counter));
+        for (std::size_t i = 0; i < RingSize / 2; i++)
+            EXPECT_TRUE(ring.pop());
+
+        EXPECT_EQ(counter.use_count(), static_cast<long>(RingSize / 2 + 1));
+    }
+
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+// If a push returns before another one starts, its element must be popped first. Every element records the clock before its push
+// started and after it returned, and the single consumer checks that no later popped element had returned before an earlier one
+// started.
+TEST(OrderedMultiProducerMultiConsumerRingBufferTest, PopOrderMatchesPushOrder)
+{
+    static constexpr std::size_t NumberOfPusherThreads = 4;
+
+    TestRingBufferType ring;
+    std::atomic_size_t clock{0};
+    std::vector<std::size_t> push_start_times(NumberOfElements);
+    std::vector<std::size_t> push_end_times(NumberOfElements);
+
+    std::vector<std::thread> pushers;
+    for (std::size_t thread_number = 0; thread_number < NumberOfPusherThreads; thread_number++)
+        pushers.emplace_back([&ring, &clock, &push_start_times, &push_end_times, thread_number]() {
+            for (std::size_t i = thread_number; i < NumberOfElements; i += NumberOfPusherThreads)
+            {
+                push_start_times[i] = clock.fetch_add(1);
+                while (!ring.push(i))
+                    std::this_thread::yield();
+                push_end_times[i] = clock.fetch_add(1);
+            }
+        });
+
+    std::vector<std::size_t> pop_order;
+    while (pop_order.size() < NumberOfElements)
+    {
+        const auto result = ring.pop();
+        if (result)
+            pop_order.push_back(*result);
+    }
+
+    for (auto &pusher : pushers)
+        pusher.join();
+
+    std::size_t violation_count = 0;
+    std::size_t earliest_later_push_end_time = push_end_times[pop_order.back()];
+    for (std::size_t i = pop_order.size() - 1; i-- > 0;)
+    {
+        if (earliest_later_push_end_time < push_start_times[pop_order[i]])
+            violation_count++;
+        if (push_end_times[pop_order[i]] < earliest_later_push_end_time)
+            earliest_later_push_end_time = push_end_times[pop_order[i]];
+    }
+    EXPECT_EQ(violation_count, 0u);
+
+    std::vector<bool> was_popped(NumberOfElements, false);
+    for (const auto value : pop_order)
+        was_popped[value] = true;
+    for (const auto popped : was_popped)
+        EXPECT_TRUE(popped);
+}
+
+TEST(OrderedMultiProducerMultiConsumerRingBufferTest, MultiProducerMultiConsumerPushPopIntegrity)
+{
+    static constexpr std::size_t NumberOfPusherThreads = 2;
+    static constexpr std::size_t NumberOfPopperThreads = 2;
+
+    TestRingBufferType ring;
+    std::array<std::atomic_size_t, NumberOfElements> pop_counts;
+    for (auto &pop_count : pop_counts)
+        pop_count = 0;
+
+    std::vector<std::thread> threads;
+    for (std::size_t thread_number = 0; thread_number < NumberOfPopperThreads; thread_number++)
+        threads.emplace_back([&ring, &pop_counts]() {
+            std::size_t last_values[NumberOfPusherThreads] = {};
+            bool has_popped[NumberOfPusherThreads] = {};
+            for (std::size_t i = 0; i < NumberOfElements / NumberOfPopperThreads; i++)
+            {
+                const auto value = WaitFreeRingBufferUtilities::pop_wait<WaitFreeRingBufferUtilities::YieldWait>(ring);
+                pop_counts[value]++;
+
+                // Each consumer sees the elements of one producer in the order they were pushed.
+                const std::size_t producer = value % NumberOfPusherThreads;
+                EXPECT_TRUE(!has_popped[producer] || last_values[producer] < value);
+                has_popped[producer] = true;
+                last_values[producer] = value;
+            }
+        });
+
+    for (std::size_t thread_number = 0; thread_number < NumberOfPusherThreads; thread_number++)
+        threads.emplace_back([&ring, thread_number]() {
+            for (std::size_t i = thread_number; i < NumberOfElements; i += NumberOfPusherThreads)
+                WaitFreeRingBufferUtilities::push_wait<WaitFreeRingBufferUtilities::YieldWait>(ring, i);
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+
+    for (const auto &pop_count : pop_counts)
+        EXPECT_EQ(pop_count, 1u);
+    EXPECT_FALSE(ring.pop());
+}
+} // namespace OrderedMultiProducerMultiConsumerRingBufferTest
+} // namespace Iyp
@@ -0,0 +1,108 @@
+#include <Iyp/WaitFreeRingBufferUtilities/pipeline.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <array>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <type_traits>
+
+namespace Iyp
+{
+namespace PipelineTest
+{
+static constexpr std::size_t RingSize = 256;
+static constexpr std::size_t NumberOfElements = 100000;
+
+TEST(PipelineTest, PolicySelection)
+{
+    using SpscType = WaitFreeRingBufferUtilities::AutoPolicyRingBuffer<int, RingSize, 1, 1>;
+    using MpmcType = WaitFreeRingBufferUtilities::AutoPolicyRingBuffer<int, RingSize, 2, 3>;
+
+    EXPECT_TRUE((std::is_same<SpscType, WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::SingleProducer,
+                                                                                WaitFreeRingBufferUtilities::SingleConsumer,
+                                                                                int,
+                                                                                RingSize>>::value));
+    EXPECT_TRUE((std::is_same<MpmcType, WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::MultiProducer,
+                                                                                WaitFreeRingBufferUtilities::MultiConsumer,
+                                                                                int,
+                                                                                RingSize>>::value));
+}
+
+TEST(PipelineTest, SingleWorkerStagesPreserveOrder)
+{
+    std::vector<std::size_t> results;
+
+    {
+        auto pipeline = WaitFreeRingBufferUtilities::make_pipeline<std::size_t>()
+                            .stage<std::size_t, RingSize>("double", [](std::size_t value) { return value * 2; })
+                            .stage<std::string, RingSize>("format", [](std::size_t value) { return std::to_string(value); })
+                            .sink<RingSize>("collect", [&results](std::string value) { results.push_back(std::stoul(value)); });
+        pipeline.start();
+
+        for (std::size_t i = 0; i < NumberOfElements; i++)
+            pipeline.push(i);
+
+        pipeline.close();
+        pipeline.join();
+
+        const auto statistics = pipeline.statistics();
+        ASSERT_EQ(statistics.size(), 3u);
+        EXPECT_EQ(statistics[0].name, "double");
+        for (const auto &stage_statistics : statistics)
+            EXPECT_EQ(stage_statistics.processed_count, NumberOfElements);
+    }
+
+    ASSERT_EQ(results.size(), NumberOfElements);
+    for (std::size_t i = 0; i < NumberOfElements; i++)
+        EXPECT_EQ(results[i], i * 2);
+}
+
+TEST(PipelineTest, MultiWorkerStagesPushPopIntegrity)
+{
+    static constexpr std::size_t NumberOfSourceThreads = 2;
+
+    std::array<std::atomic_size_t, NumberOfElements> pop_counts;
+    for (auto &pop_count : pop_counts)
+        pop_count = 0;
+
+    auto pipeline = WaitFreeRingBufferUtilities::make_pipeline<std::size_t, NumberOfSourceThreads>()
+                        .stage<std::size_t, RingSize, 3>("identity", [](std::size_t value) { return value; })
+                        .sink<RingSize, 2>("count", [&pop_counts](std::size_t value) { pop_counts[value].fetch_add(1, std::memory_order_relaxed); });
+    pipeline.start();
+
+    std::vector<std::thread> sources;
+    for (std::size_t thread_number = 0; thread_number < NumberOfSourceThreads; thread_number++)
+        sources.emplace_back([&pipeline, thread_number]() {
+            for (std::size_t i = thread_number; i < NumberOfElements; i += NumberOfSourceThreads)
+                pipeline.push(i);
+        });
+
+    for (auto &source : sources)
+        source.join();
+
+    pipeline.close();
+    pipeline.join();
+
+    for (const auto &pop_count : pop_counts)
+        EXPECT_EQ(pop_count, 1u);
+}
+
+TEST(PipelineTest, DestructionDrainsPushedElements)
+{
+    std::atomic_size_t processed_count{0};
+
+    {
+        auto pipeline = WaitFreeRingBufferUtilities::make_pipeline<std::size_t>()
+                            .sink<RingSize>("count", [&processed_count](std::size_t) { processed_count++; });
+
+        for (std::size_t i = 0; i < RingSize; i++)
+            EXPECT_TRUE(pipeline.try_push(std::size_t(i)));
+        EXPECT_FALSE(pipeline.try_push(std::size_t(0)));
+    }
+
+    EXPECT_EQ(processed_count, RingSize);
+}
+} // namespace PipelineTest
+} // namespace Iyp
@@ -0,0 +1,165 @@
+#include <Iyp/WaitFreeRingBufferUtilities/segmented-ring-buffer.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <array>
+#include <thread>
+#include <atomic>
+#include <string>
+
+namespace Iyp
+{
+namespace SegmentedRingBufferTest
+{
+static constexpr std::size_t SegmentSize = 16;
+static constexpr std::size_t MaxSegmentCount = 8;
+
+struct CountedElement
+{
+    static std::atomic_int live_count;
+    std::string text;
+
+    explicit CountedElement(std::string i_text) : text(std::move(i_text)) { live_count++; }
+    CountedElement(const CountedElement &other) : text(other.text) { live_count++; }
+    CountedElement(CountedElement &&other) : text(std::move(other.text)) { live_count++; }
+    ~CountedElement() { live_count--; }
+};
+
+std::atomic_int CountedElement::live_count{0};
+
+using TestRingBufferType = WaitFreeRingBufferUtilities::SegmentedRingBuffer<std::size_t, SegmentSize, MaxSegmentCount>;
+
+TEST(SegmentedRingBufferTest, OrderedPushPopAcrossSegments)
+{
+    TestRingBufferType ring;
+    EXPECT_FALSE(ring.pop());
+
+    for (std::size_t round = 0; round < 64; round++)
+    {
+        const std::size_t element_count = (round % (MaxSegmentCount - 2)) * SegmentSize + round % SegmentSize;
+        for (std::size_t i = 0; i < element_count; i++)
+            EXPECT_TRUE(ring.push(i));
+
+        for (std::size_t i = 0; i < element_count; i++)
+            EXPECT_EQ(*ring.pop(), i);
+        EXPECT_FALSE(ring.pop());
+    }
+}
+
+TEST(SegmentedRingBufferTest, FailsOnlyWhenTheDirectoryIsFull)
+{
+    TestRingBufferType ring;
+
+    std::size_t pushed_count = 0;
+    while (ring.push(pushed_count))
+        pushed_count++;
+    EXPECT_EQ(pushed_count, (MaxSegmentCount - 1) * SegmentSize);
+
+    for (std::size_t i = 0; i < SegmentSize - 1; i++)
+        EXPECT_EQ(*ring.pop(), i);
+    EXPECT_FALSE(ring.push(pushed_count));
+
+    EXPECT_EQ(*ring.pop(), SegmentSize - 1);
+    for (std::size_t i = 0; i < SegmentSize; i++)
+        EXPECT_TRUE(ring.push(pushed_count + i));
+    EXPECT_FALSE(ring.push(pushed_count + SegmentSize));
+
+    for (std::size_t i = SegmentSize; i < pushed_count + SegmentSize; i++)
+        EXPECT_EQ(*ring.pop(), i);
+    EXPECT_FALSE(ring.pop());
+}
+
+TEST(SegmentedRingBufferTest, DestructorDestroysRemainingElements)
+{
+    {
+        WaitFreeRingBufferUtilities::SegmentedRingBuffer<CountedElement, SegmentSize, MaxSegmentCount> ring;
+        for (std::size_t i = 0; i < SegmentSize * 3; i++)
+            EXPECT_TRUE(ring.push(std::to_string(i)));
+        for (std::size_t i = 0; i < SegmentSize + 1; i++)
+            EXPECT_EQ(ring.pop()->text, std::to_string(i));
+
+        EXPECT_EQ(CountedElement::live_count, static_cast<int>(SegmentSize * 2 - 1));
+    }
+
+    EXPECT_EQ(CountedElement::live_count, 0);
+}
+
+template <typename RingType>
+void push_pop_under_contention(RingType &ring)
+{
+    static constexpr std::size_t NumberOfPusherThreads = 4;
+    static constexpr std::size_t NumberOfElements = 1 << 14;
+
+    std::array<std::atomic_size_t, NumberOfElements> pop_counts;
+    for (auto &pop_count : pop_counts)
+        pop_count = 0;
+
+    std::vector<std::thread> threads;
+    threads.emplace_back([&ring, &pop_counts]() {
+        for (std::size_t i = 0; i < NumberOfElements;)
+        {
+            const auto result = ring.pop();
+            if (result)
+            {
+                pop_counts[*result]++;
+                i++;
+            }
+        }
+    });
+
+    for (std::size_t thread_number = 0; thread_number < NumberOfPusherThreads; thread_number++)
+        threads.emplace_back([&ring, thread_number]() {
+            for (std::size_t i = thread_number; i < NumberOfElements; i += NumberOfPusherThreads)
+                while (!ring.push(i))
+                    std::this_thread::yield();
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+
+    for (const auto &pop_count : pop_counts)
+        EXPECT_EQ(pop_count, 1u);
+    EXPECT_FALSE(ring.pop());
+}
+
+TEST(SegmentedRingBufferTest, MultiProducerSingleConsumerPushPopIntegrity)
+{
+    TestRingBufferType ring;
+    push_pop_under_contention(ring);
+}
+
+// With two slots per segment, producers keep racing each other to install the next segment.
+TEST(SegmentedRingBufferTest, ProducersRacingToInstallSegments)
+{
+    WaitFreeRingBufferUtilities::SegmentedRingBuffer<std::size_t, 2, 64, 1> ring;
+    push_pop_under_contention(ring);
+}
+
+// Producers racing into a full queue all get false back instead of waiting for the consumer to retire a segment.
+TEST(SegmentedRingBufferTest, ProducersRacingIntoAFullQueueFail)
+{
+    static constexpr std::size_t NumberOfPusherThreads = 8;
+    WaitFreeRingBufferUtilities::SegmentedRingBuffer<std::size_t, 1, 2, 1> ring;
+
+    std::atomic_bool is_started{false};
+    std::atomic_size_t pushed_count{0};
+    std::vector<std::thread> threads;
+    for (std::size_t thread_number = 0; thread_number < NumberOfPusherThreads; thread_number++)
+        threads.emplace_back([&ring, &is_started, &pushed_count, thread_number]() {
+            while (!is_started)
+                std::this_thread::yield();
+            for (std::size_t i = 0; i < 1024; i++)
+                if (ring.push(thread_number))
+                    pushed_count++;
+        });
+
+    is_started = true;
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_EQ(pushed_count, 1u);
+    EXPECT_TRUE(ring.pop());
+    EXPECT_FALSE(ring.pop());
+}
+} // namespace SegmentedRingBufferTest
+} // namespace Iyp
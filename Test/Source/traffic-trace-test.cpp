@@ -0,0 +1,189 @@
+#include <Iyp/WaitFreeRingBufferUtilities/traffic-trace.inl>
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <cstdio>
+#include <set>
+#include <algorithm>
+
+namespace Iyp
+{
+namespace TrafficTraceTest
+{
+static constexpr std::size_t RingSize = 16;
+static constexpr std::size_t NumberOfElements = 4096;
+static constexpr std::size_t NumberOfProducerThreads = 2;
+
+using TracedRingBufferType = WaitFreeRingBufferUtilities::TracingRingBuffer<WaitFreeRingBufferUtilities::MultiProducer,
+                                                                            WaitFreeRingBufferUtilities::SingleConsumer,
+                                                                            std::size_t,
+                                                                            RingSize>;
+
+void capture_trace(std::FILE *const file)
+{
+    TracedRingBufferType ring;
+
+    std::vector<std::thread> threads;
+    threads.emplace_back([&ring]() {
+        for (std::size_t i = 0; i < NumberOfElements; i++)
+            WaitFreeRingBufferUtilities::pop_wait<WaitFreeRingBufferUtilities::YieldWait>(ring);
+    });
+    for (std::size_t thread_number = 0; thread_number < NumberOfProducerThreads; thread_number++)
+        threads.emplace_back([&ring]() {
+            for (std::size_t i = 0; i < NumberOfElements / NumberOfProducerThreads; i++)
+                WaitFreeRingBufferUtilities::push_wait<WaitFreeRingBufferUtilities::YieldWait>(ring, i);
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_TRUE(ring.write_trace(file));
+    std::rewind(file);
+}
+
+TEST(TrafficTraceTest, CapturedTraceCanBeReadBack)
+{
+    std::FILE *const file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    capture_trace(file);
+
+    WaitFreeRingBufferUtilities::TraceHeader header;
+    std::vector<WaitFreeRingBufferUtilities::TraceEvent> events;
+    ASSERT_TRUE(WaitFreeRingBufferUtilities::read_trace(file, header, events));
+    std::fclose(file);
+
+    EXPECT_EQ(header.element_size, sizeof(std::size_t));
+    EXPECT_EQ(header.event_count, 2 * NumberOfElements);
+    EXPECT_EQ(header.dropped_event_count, 0u);
+
+    std::set<std::uint32_t> pushing_threads;
+    std::set<std::uint32_t> popping_threads;
+    std::size_t pushed_count = 0;
+    for (std::size_t i = 0; i < events.size(); i++)
+    {
+        if (i)
+        {
+            EXPECT_LE(events[i - 1].timestamp_ns, events[i].timestamp_ns);
+        }
+
+        if (events[i].kind == WaitFreeRingBufferUtilities::TraceEventKind::PUSH)
+        {
+            pushing_threads.insert(events[i].thread_index);
+            pushed_count++;
+        }
+        else
+            popping_threads.insert(events[i].thread_index);
+    }
+    EXPECT_EQ(pushed_count, NumberOfElements);
+    EXPECT_EQ(pushing_threads.size(), NumberOfProducerThreads);
+    EXPECT_EQ(popping_threads.size(), 1u);
+}
+
+TEST(TrafficTraceTest, EventsPastTheCapacityAreCountedAsDropped)
+{
+    WaitFreeRingBufferUtilities::TracingRingBuffer<WaitFreeRingBufferUtilities::SingleProducer,
+                                                   WaitFreeRingBufferUtilities::SingleConsumer,
+                                                   std::size_t, RingSize, 8>
+        ring;
+    for (std::size_t i = 0; i < RingSize; i++)
+        EXPECT_TRUE(ring.push(i));
+    EXPECT_FALSE(ring.push(std::size_t(0))); // Failed pushes are not traced.
+
+    std::FILE *const file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    EXPECT_TRUE(ring.write_trace(file));
+    std::rewind(file);
+
+    WaitFreeRingBufferUtilities::TraceHeader header;
+    std::vector<WaitFreeRingBufferUtilities::TraceEvent> events;
+    ASSERT_TRUE(WaitFreeRingBufferUtilities::read_trace(file, header, events));
+    std::fclose(file);
+
+    EXPECT_EQ(events.size(), 8u);
+    EXPECT_EQ(header.dropped_event_count, RingSize - 8);
+}
+
+TEST(TrafficTraceTest, ThreadsDropOnceTheLogHasNoChunkLeft)
+{
+    static constexpr std::size_t EventCapacity = 2 * 1024;
+
+    // Three threads each want a chunk of the two the log holds, so the events of one of them are dropped.
+    WaitFreeRingBufferUtilities::TracingRingBuffer<WaitFreeRingBufferUtilities::MultiProducer,
+                                                   WaitFreeRingBufferUtilities::MultiConsumer,
+                                                   std::size_t, RingSize, EventCapacity>
+        ring;
+    std::vector<std::thread> threads;
+    for (std::size_t thread_number = 0; thread_number < 3; thread_number++)
+        threads.emplace_back([&ring]() {
+            for (std::size_t i = 0; i < 100; i++)
+            {
+                EXPECT_TRUE(ring.push(i));
+                EXPECT_TRUE(ring.pop());
+            }
+        });
+    for (auto &thread : threads)
+        thread.join();
+
+    std::FILE *const file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    EXPECT_TRUE(ring.write_trace(file));
+    std::rewind(file);
+
+    WaitFreeRingBufferUtilities::TraceHeader header;
+    std::vector<WaitFreeRingBufferUtilities::TraceEvent> events;
+    ASSERT_TRUE(WaitFreeRingBufferUtilities::read_trace(file, header, events));
+    std::fclose(file);
+
+    EXPECT_EQ(events.size(), 400u);
+    EXPECT_EQ(header.dropped_event_count, 200u);
+    std::set<std::uint32_t> traced_threads;
+    for (const auto &event : events)
+        traced_threads.insert(event.thread_index);
+    EXPECT_EQ(traced_threads.size(), 2u);
+}
+
+TEST(TrafficTraceTest, ReplayAgainstOtherPolicies)
+{
+    std::FILE *const file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    capture_trace(file);
+
+    WaitFreeRingBufferUtilities::TraceHeader header;
+    std::vector<WaitFreeRingBufferUtilities::TraceEvent> events;
+    ASSERT_TRUE(WaitFreeRingBufferUtilities::read_trace(file, header, events));
+    std::fclose(file);
+
+    for (const double rate_scale : {0.0, 1.0, 4.0})
+    {
+        WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::MultiProducer,
+                                                WaitFreeRingBufferUtilities::MultiConsumer,
+                                                std::size_t,
+                                                RingSize>
+            ring;
+        const auto result = WaitFreeRingBufferUtilities::replay_trace(ring, events, rate_scale);
+
+        EXPECT_EQ(result.push_count, NumberOfElements);
+        EXPECT_EQ(result.pop_count, NumberOfElements);
+        EXPECT_EQ(result.abandoned_count, 0u);
+        EXPECT_FALSE(ring.pop());
+    }
+
+    // A trace missing its pops must not hang the replay.
+    events.erase(std::remove_if(events.begin(), events.end(), [](const WaitFreeRingBufferUtilities::TraceEvent &event) {
+                     return event.kind == WaitFreeRingBufferUtilities::TraceEventKind::POP;
+                 }),
+                 events.end());
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::MultiProducer,
+                                            WaitFreeRingBufferUtilities::MultiConsumer,
+                                            std::size_t,
+                                            RingSize>
+        ring;
+    const auto result = WaitFreeRingBufferUtilities::replay_trace(ring, events, 0.0);
+    EXPECT_EQ(result.push_count, RingSize);
+    EXPECT_EQ(result.abandoned_count, NumberOfElements - RingSize);
+}
+} // namespace TrafficTraceTest
+} // namespace Iyp
@@ -0,0 +1,101 @@
+#include <Iyp/WaitFreeRingBufferUtilities/wait-free-ring-buffer-utilities.inl>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <array>
+#include <thread>
+#include <atomic>
+
+namespace Iyp
+{
+namespace WaitStrategyTest
+{
+static constexpr std::size_t RingSize = 64;
+static constexpr std::size_t NumberOfElements = 4096;
+
+template <typename WaitStrategy>
+using TestRingBufferType = WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::ConfiguredPolicies<WaitFreeRingBufferUtilities::PolicyConfiguration<WaitStrategy>>::template MultiProducer,
+                                                                   WaitFreeRingBufferUtilities::ConfiguredPolicies<WaitFreeRingBufferUtilities::PolicyConfiguration<WaitStrategy>>::template MultiConsumer,
+                                                                   std::size_t,
+                                                                   RingSize>;
+
+template <typename WaitStrategy>
+void push_wait_pop_wait_integrity()
+{
+    static constexpr std::size_t NumberOfPusherThreads = 2;
+    static constexpr std::size_t NumberOfPopperThreads = 2;
+
+    TestRingBufferType<WaitStrategy> ring;
+    std::array<std::atomic_size_t, NumberOfElements> pop_counts;
+    for (auto &pop_count : pop_counts)
+        pop_count = 0;
+
+    std::vector<std::thread> threads;
+    for (std::size_t thread_number = 0; thread_number < NumberOfPopperThreads; thread_number++)
+        threads.emplace_back([&ring, &pop_counts]() {
+            for (std::size_t i = 0; i < NumberOfElements / NumberOfPopperThreads; i++)
+                pop_counts[WaitFreeRingBufferUtilities::pop_wait<WaitStrategy>(ring)].fetch_add(1, std::memory_order_relaxed);
+        });
+
+    for (std::size_t thread_number = 0; thread_number < NumberOfPusherThreads; thread_number++)
+        threads.emplace_back([&ring, thread_number]() {
+            for (std::size_t i = thread_number; i < NumberOfElements; i += NumberOfPusherThreads)
+                WaitFreeRingBufferUtilities::push_wait<WaitStrategy>(ring, i);
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+
+    for (const auto &pop_count : pop_counts)
+        EXPECT_EQ(pop_count, 1u);
+    EXPECT_FALSE(ring.pop());
+}
+
+TEST(WaitStrategyTest, BusySpinWaitPushPopIntegrity)
+{
+    push_wait_pop_wait_integrity<WaitFreeRingBufferUtilities::BusySpinWait>();
+}
+
+TEST(WaitStrategyTest, PauseWaitPushPopIntegrity)
+{
+    push_wait_pop_wait_integrity<WaitFreeRingBufferUtilities::PauseWait>();
+}
+
+TEST(WaitStrategyTest, ExponentialBackoffWaitPushPopIntegrity)
+{
+    push_wait_pop_wait_integrity<WaitFreeRingBufferUtilities::ExponentialBackoffWait<64>>();
+}
+
+TEST(WaitStrategyTest, YieldWaitPushPopIntegrity)
+{
+    push_wait_pop_wait_integrity<WaitFreeRingBufferUtilities::YieldWait>();
+}
+
+TEST(WaitStrategyTest, SleepWaitPushPopIntegrity)
+{
+    push_wait_pop_wait_integrity<WaitFreeRingBufferUtilities::SleepWait<1>>();
+}
+
+TEST(WaitStrategyTest, PushWaitDoesNotConsumeArgumentsOnFailedAttempts)
+{
+    WaitFreeRingBufferUtilities::RingBuffer<WaitFreeRingBufferUtilities::SingleProducer,
+                                            WaitFreeRingBufferUtilities::SingleConsumer,
+                                            std::vector<std::size_t>,
+                                            1>
+        ring;
+
+    EXPECT_TRUE(ring.push(std::vector<std::size_t>{0}));
+
+    std::thread popper([&ring]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        EXPECT_EQ(ring.pop()->size(), 1u);
+    });
+
+    std::vector<std::size_t> value{1, 2, 3};
+    WaitFreeRingBufferUtilities::push_wait<WaitFreeRingBufferUtilities::YieldWait>(ring, std::move(value));
+    popper.join();
+
+    EXPECT_EQ(WaitFreeRingBufferUtilities::pop_wait(ring), (std::vector<std::size_t>{1, 2, 3}));
+}
+} // namespace WaitStrategyTest
+} // namespace Iyp
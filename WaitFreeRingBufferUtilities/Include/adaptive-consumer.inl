@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/adaptive-side.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/ordered-multi-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/optional-type.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/policy-configuration.inl"
+
+#include <cstddef>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+// Consumer counterpart of BasicAdaptiveProducer: the single consumer protocol while at most one consumer thread is attached, and the
+// strict FIFO multi consumer protocol of BasicOrderedMultiConsumer while more are.
+template <typename ElementType, std::size_t Count, typename Configuration>
+class BasicAdaptiveConsumer : public Private::UsesSequencedElements
+{
+    static_assert(Count >= 2, "With a single slot the full sequence of one round is the free sequence of the next, Count should be at least 2.");
+
+    BasicOrderedMultiConsumer<ElementType, Count, Configuration> consumer;
+    Private::AdaptiveSide side;
+
+public:
+    enum : bool
+    {
+        TOLERATES_SKIPPED_TICKETS = false,
+    };
+
+    template <typename Ring>
+    void notify_push(const Ring &) const
+    {
+    }
+
+    template <typename Ring>
+    OptionalType<ElementType> pop_impl(Ring &ring)
+    {
+        if (!side.try_enter_exclusive())
+            return consumer.pop_impl(ring);
+
+        auto result = consumer.pop_exclusive_impl(ring);
+        side.leave_exclusive();
+        return result;
+    }
+
+    void attach_consumer_impl()
+    {
+        side.attach();
+    }
+
+    void detach_consumer_impl()
+    {
+        side.detach();
+    }
+};
+
+template <typename ElementType, std::size_t Count>
+using AdaptiveConsumer = BasicAdaptiveConsumer<ElementType, Count, DefaultPolicyConfiguration>;
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/adaptive-side.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/ordered-multi-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/policy-configuration.inl"
+
+#include <utility>
+#include <cstddef>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+// Producer that runs the cheap single producer protocol while at most one producer thread is attached, and the strict FIFO multi
+// producer protocol of BasicOrderedMultiProducer while more are. Every thread that pushes should call attach_producer() first and
+// detach_producer() once it is done; a ring nobody attached to behaves like a single producer ring. Pairs with the ordered and
+// adaptive consumers.
+template <typename ElementType, std::size_t Count, typename Configuration>
+class BasicAdaptiveProducer : public Private::UsesSequencedElements
+{
+    static_assert(Count >= 2, "With a single slot the full sequence of one round is the free sequence of the next, Count should be at least 2.");
+
+    BasicOrderedMultiProducer<ElementType, Count, Configuration> producer;
+    Private::AdaptiveSide side;
+
+public:
+    template <typename Ring>
+    void notify_pop(const Ring &) const
+    {
+    }
+
+    template <typename Ring, typename... Args>
+    bool push_impl(Ring &ring, Args &&...args)
+    {
+        if (!side.try_enter_exclusive())
+            return producer.push_impl(ring, std::forward<Args>(args)...);
+
+        bool is_pushed;
+        try
+        {
+            is_pushed = producer.push_exclusive_impl(ring, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            side.leave_exclusive(); // Otherwise a thread attaching later would wait for this push forever.
+            throw;
+        }
+        side.leave_exclusive();
+        return is_pushed;
+    }
+
+    void attach_producer_impl()
+    {
+        side.attach();
+    }
+
+    void detach_producer_impl()
+    {
+        side.detach();
+    }
+};
+
+template <typename ElementType, std::size_t Count>
+using AdaptiveProducer = BasicAdaptiveProducer<ElementType, Count, DefaultPolicyConfiguration>;
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
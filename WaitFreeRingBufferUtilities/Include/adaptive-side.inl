@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/details/asymmetric-fence.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
+
+#include <cstddef>
+#include <atomic>
+#include <thread>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+namespace Private
+{
+// Tracks the threads attached to one side of a ring, and whether that side has to run its shared protocol. With at most one thread
+// attached the side is exclusive: operations only bracket themselves with a flag and a light fence. The second thread to attach
+// switches the side to shared, and waits with a heavy fence until the first one is out of any exclusive operation it started.
+class AdaptiveSide
+{
+    struct ModeState
+    {
+        std::atomic_bool is_shared{false};
+        std::atomic_bool is_in_exclusive_operation{false};
+    };
+
+    struct Registration
+    {
+        std::size_t attached_count{0};
+        std::atomic_flag is_locked = ATOMIC_FLAG_INIT;
+    };
+
+    Details::CacheAlignedAndPaddedObject<ModeState> mode_state;
+    Details::CacheAlignedAndPaddedObject<Registration> registration;
+
+    void lock()
+    {
+        while (registration.is_locked.test_and_set(std::memory_order_acquire))
+            std::this_thread::yield();
+    }
+
+    void unlock()
+    {
+        registration.is_locked.clear(std::memory_order_release);
+    }
+
+public:
+    // On success the caller runs the exclusive protocol and then calls leave_exclusive(), otherwise it runs the shared one.
+    bool try_enter_exclusive()
+    {
+        ModeState &state = mode_state;
+        if (state.is_shared.load(std::memory_order_relaxed))
+            return false;
+
+        state.is_in_exclusive_operation.store(true, std::memory_order_relaxed);
+        Details::light_fence();
+        if (!state.is_shared.load(std::memory_order_acquire))
+            return true;
+
+        state.is_in_exclusive_operation.store(false, std::memory_order_release);
+        return false;
+    }
+
+    void leave_exclusive()
+    {
+        mode_state.is_in_exclusive_operation.store(false, std::memory_order_release);
+    }
+
+    void attach()
+    {
+        lock();
+        if (registration.attached_count++ == 1)
+        {
+            ModeState &state = mode_state;
+            state.is_shared.store(true, std::memory_order_relaxed);
+            Details::heavy_fence();
+            while (state.is_in_exclusive_operation.load(std::memory_order_acquire))
+                std::this_thread::yield();
+        }
+        unlock();
+    }
+
+    // Should only be called once the thread is done with the ring, the remaining thread then goes back to the exclusive protocol.
+    void detach()
+    {
+        lock();
+        if (--registration.attached_count == 1)
+            mode_state.is_shared.store(false, std::memory_order_release);
+        unlock();
+    }
+};
+} // namespace Private
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
@@ -0,0 +1,278 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/multi-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/single-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/wait-strategy.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/aligned-allocation.inl"
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <atomic>
+#include <array>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+namespace Private
+{
+enum class LogArgumentType : std::uint8_t
+{
+    BOOL,
+    CHAR,
+    SIGNED,
+    UNSIGNED,
+    DOUBLE,
+    STRING,
+    POINTER,
+};
+
+union LogArgumentValue
+{
+    std::int64_t signed_value;
+    std::uint64_t unsigned_value;
+    double double_value;
+    const char *string_value;
+    const void *pointer_value;
+};
+
+inline void encode_log_argument(LogArgumentType &type, LogArgumentValue &value, const bool argument)
+{
+    type = LogArgumentType::BOOL;
+    value.unsigned_value = argument;
+}
+
+inline void encode_log_argument(LogArgumentType &type, LogArgumentValue &value, const char argument)
+{
+    type = LogArgumentType::CHAR;
+    value.signed_value = argument;
+}
+
+inline void encode_log_argument(LogArgumentType &type, LogArgumentValue &value, const char *const argument)
+{
+    type = LogArgumentType::STRING;
+    value.string_value = argument;
+}
+
+inline void encode_log_argument(LogArgumentType &type, LogArgumentValue &value, char *const argument)
+{
+    encode_log_argument(type, value, static_cast<const char *>(argument));
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type encode_log_argument(LogArgumentType &type, LogArgumentValue &value, const T argument)
+{
+    type = LogArgumentType::SIGNED;
+    value.signed_value = argument;
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type encode_log_argument(LogArgumentType &type, LogArgumentValue &value, const T argument)
+{
+    type = LogArgumentType::UNSIGNED;
+    value.unsigned_value = argument;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value>::type encode_log_argument(LogArgumentType &type, LogArgumentValue &value, const T argument)
+{
+    type = LogArgumentType::DOUBLE;
+    value.double_value = argument;
+}
+
+template <typename T>
+void encode_log_argument(LogArgumentType &type, LogArgumentValue &value, T *const argument)
+{
+    type = LogArgumentType::POINTER;
+    value.pointer_value = argument;
+}
+
+// A log call as it travels through the ring: the format pointer, a type tag per argument and the raw argument values.
+template <std::size_t MaxArgumentCount>
+struct LogRecord
+{
+    const char *format;
+    std::uint8_t argument_count;
+    std::array<LogArgumentType, MaxArgumentCount> types;
+    std::array<LogArgumentValue, MaxArgumentCount> values;
+
+    template <typename... Args>
+    explicit LogRecord(const char *const i_format, const Args &...args) : format(i_format),
+                                                                        argument_count(sizeof...(Args))
+    {
+        std::size_t index = 0;
+        using Expander = int[];
+        (void)Expander{0, (encode_log_argument(types[index], values[index], args), index++, 0)...};
+    }
+};
+
+inline void append_log_argument(std::string &buffer, const LogArgumentType type, const LogArgumentValue value)
+{
+    char text[32];
+    int length = 0;
+
+    switch (type)
+    {
+    case LogArgumentType::BOOL:
+        buffer += value.unsigned_value ? "true" : "false";
+        return;
+    case LogArgumentType::CHAR:
+        buffer += static_cast<char>(value.signed_value);
+        return;
+    case LogArgumentType::STRING:
+        buffer += value.string_value ? value.string_value : "(null)";
+        return;
+    case LogArgumentType::SIGNED:
+        length = std::snprintf(text, sizeof(text), "%lld", static_cast<long long>(value.signed_value));
+        break;
+    case LogArgumentType::UNSIGNED:
+        length = std::snprintf(text, sizeof(text), "%llu", static_cast<unsigned long long>(value.unsigned_value));
+        break;
+    case LogArgumentType::DOUBLE:
+        length = std::snprintf(text, sizeof(text), "%g", value.double_value);
+        break;
+    case LogArgumentType::POINTER:
+        length = std::snprintf(text, sizeof(text), "%p", value.pointer_value);
+        break;
+    }
+
+    if (length > 0)
+        buffer.append(text, static_cast<std::size_t>(length));
+}
+
+// Replaces every "{}" of the format with the next argument. Placeholders without an argument are kept as they are.
+template <std::size_t MaxArgumentCount>
+void append_log_record(std::string &buffer, const LogRecord<MaxArgumentCount> &record)
+{
+    std::size_t argument_index = 0;
+    for (const char *character = record.format; *character; character++)
+    {
+        if (character[0] == '{' && character[1] == '}' && argument_index < record.argument_count)
+        {
+            append_log_argument(buffer, record.types[argument_index], record.values[argument_index]);
+            argument_index++;
+            character++;
+        }
+        else
+            buffer += *character;
+    }
+    buffer += '\n';
+}
+} // namespace Private
+
+// Asynchronous logger for hot threads. log() only pushes the format pointer and a compact binary copy of the arguments onto a
+// MultiProducer/SingleConsumer ring, without formatting or allocating. A background thread formats the records into a buffer and
+// writes it to the file in large batches, either when it fills up or when the ring runs dry.
+//
+// The format and every string argument are stored by pointer, so they should outlive the logger, string literals being the usual
+// case. Arguments are substituted for "{}" placeholders. When the ring is full the record is dropped and counted, and the background
+// thread reports the number of dropped records in the output. The file is not owned by the logger.
+template <std::size_t RingSize = 4096, std::size_t MaxArgumentCount = 8, typename WaitStrategy = SleepWait<100>>
+class AsyncLogger
+{
+    using Record = Private::LogRecord<MaxArgumentCount>;
+    using RingType = RingBuffer<MultiProducer, SingleConsumer, Record, RingSize>;
+
+    std::FILE *const file;
+    const std::size_t write_size;
+    Details::AlignedUniquePtr<RingType> ring{Details::make_aligned_unique<RingType>()};
+    Details::CacheAlignedAndPaddedObject<std::atomic_size_t> dropped_record_count;
+    std::atomic_bool should_stop{false};
+    std::string buffer;
+    std::thread writer;
+
+    void write_buffer()
+    {
+        if (!buffer.empty())
+            std::fwrite(buffer.data(), 1, buffer.size(), file);
+        buffer.clear();
+    }
+
+    void write()
+    {
+        WaitStrategy wait_strategy;
+        std::size_t reported_dropped_record_count = 0;
+
+        while (true)
+        {
+            const bool was_stopped = should_stop.load(std::memory_order_acquire);
+
+            bool is_empty = true;
+            while (auto record = ring->pop())
+            {
+                Private::append_log_record(buffer, *record);
+                is_empty = false;
+                if (buffer.size() >= write_size)
+                    write_buffer();
+            }
+
+            const std::size_t current_dropped_record_count = dropped_record_count.load(std::memory_order_relaxed);
+            if (current_dropped_record_count != reported_dropped_record_count)
+            {
+                buffer += "AsyncLogger dropped " + std::to_string(current_dropped_record_count - reported_dropped_record_count) + " records\n";
+                reported_dropped_record_count = current_dropped_record_count;
+                is_empty = false;
+            }
+
+            write_buffer();
+
+            if (was_stopped && is_empty)
+                break;
+            if (is_empty)
+                wait_strategy.wait();
+            else
+                wait_strategy = WaitStrategy{};
+        }
+
+        std::fflush(file);
+    }
+
+public:
+    explicit AsyncLogger(std::FILE *const i_file, const std::size_t i_write_size = 64 * 1024) : file(i_file),
+                                                                                                 write_size(i_write_size)
+    {
+        dropped_record_count.store(0, std::memory_order_relaxed);
+        buffer.reserve(write_size + 1024);
+        writer = std::thread([this]() { write(); });
+    }
+
+    AsyncLogger(const AsyncLogger &) = delete;
+    AsyncLogger(AsyncLogger &&) = delete;
+
+    AsyncLogger &operator=(const AsyncLogger &) = delete;
+    AsyncLogger &operator=(AsyncLogger &&) = delete;
+
+    // Returns false, and counts the record as dropped, if the ring is full.
+    template <typename... Args>
+    bool log(const char *const format, const Args &...args)
+    {
+        static_assert(sizeof...(Args) <= MaxArgumentCount, "Too many arguments for MaxArgumentCount.");
+
+        if (ring->push(format, args...))
+            return true;
+
+        dropped_record_count.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    std::size_t dropped_count() const
+    {
+        return dropped_record_count.load(std::memory_order_relaxed);
+    }
+
+    // Writes every record logged before the call, then stops the background thread.
+    ~AsyncLogger()
+    {
+        should_stop.store(true, std::memory_order_release);
+        writer.join();
+    }
+};
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
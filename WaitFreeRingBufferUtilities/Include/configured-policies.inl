@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/policy-configuration.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/multi-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/multi-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/single-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/single-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/ordered-multi-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/ordered-multi-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/adaptive-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/adaptive-consumer.inl"
+
+#include <cstddef>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+// Usage: RingBuffer<ConfiguredPolicies<PolicyConfiguration<PauseWait>>::MultiProducer, MultiConsumer, ElementType, Count>
+// or, with prefetching 4 slots ahead and streaming stores for elements of 256 bytes and more:
+// RingBuffer<ConfiguredPolicies<PolicyConfiguration<BusySpinWait, 4, 256>>::SingleProducer, ..., ElementType, Count>
+template <typename Configuration>
+struct ConfiguredPolicies
+{
+    template <typename ElementType, std::size_t Count>
+    using MultiProducer = BasicMultiProducer<ElementType, Count, Configuration>;
+
+    template <typename ElementType, std::size_t Count>
+    using MultiConsumer = BasicMultiConsumer<ElementType, Count, Configuration>;
+
+    template <typename ElementType, std::size_t Count>
+    using SingleProducer = BasicSingleProducer<ElementType, Count, Configuration>;
+
+    template <typename ElementType, std::size_t Count>
+    using SingleConsumer = BasicSingleConsumer<ElementType, Count, Configuration>;
+
+    template <typename ElementType, std::size_t Count>
+    using OrderedMultiProducer = BasicOrderedMultiProducer<ElementType, Count, Configuration>;
+
+    template <typename ElementType, std::size_t Count>
+    using OrderedMultiConsumer = BasicOrderedMultiConsumer<ElementType, Count, Configuration>;
+
+    template <typename ElementType, std::size_t Count>
+    using AdaptiveProducer = BasicAdaptiveProducer<ElementType, Count, Configuration>;
+
+    template <typename ElementType, std::size_t Count>
+    using AdaptiveConsumer = BasicAdaptiveConsumer<ElementType, Count, Configuration>;
+};
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+namespace Details
+{
+namespace Private
+{
+// Operator new does not honour extended alignments before C++17, so the original pointer is stashed right before the aligned block.
+inline void *allocate_aligned(const std::size_t size, const std::size_t alignment)
+{
+    const std::size_t header_size = sizeof(void *);
+    void *const raw_memory = ::operator new(size + alignment + header_size);
+    const std::uintptr_t aligned_address = (reinterpret_cast<std::uintptr_t>(raw_memory) + header_size + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+    void *const aligned_memory = reinterpret_cast<void *>(aligned_address);
+    static_cast<void **>(aligned_memory)[-1] = raw_memory;
+    return aligned_memory;
+}
+
+inline void deallocate_aligned(void *const aligned_memory)
+{
+    if (aligned_memory)
+        ::operator delete(static_cast<void **>(aligned_memory)[-1]);
+}
+} // namespace Private
+
+template <typename T>
+struct AlignedDeleter
+{
+    void operator()(T *const object) const
+    {
+        if (!object)
+            return;
+
+        object->~T();
+        Private::deallocate_aligned(object);
+    }
+};
+
+template <typename T>
+using AlignedUniquePtr = std::unique_ptr<T, AlignedDeleter<T>>;
+
+template <typename T, typename... Args>
+AlignedUniquePtr<T> make_aligned_unique(Args &&...args)
+{
+    void *const memory = Private::allocate_aligned(sizeof(T), alignof(T));
+    try
+    {
+        return AlignedUniquePtr<T>{new (memory) T(std::forward<Args>(args)...)};
+    }
+    catch (...)
+    {
+        Private::deallocate_aligned(memory);
+        throw;
+    }
+}
+} // namespace Details
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
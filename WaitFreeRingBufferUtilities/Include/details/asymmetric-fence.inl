@@ -0,0 +1,48 @@
+#pragma once
+
+#ifdef __linux__
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+namespace Details
+{
+// A Dekker style handshake needs a full fence on both sides. When one side is hot and the other rare, membarrier lets the hot side
+// get away with a compiler barrier, and the rare side pays for a barrier on every running thread of the process instead. Without
+// membarrier both sides fall back to a full fence.
+inline bool has_process_wide_barrier()
+{
+#if defined(__linux__) && defined(__NR_membarrier)
+    static const bool is_registered = syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0;
+    return is_registered;
+#else
+    return false;
+#endif
+}
+
+inline void light_fence()
+{
+    if (has_process_wide_barrier())
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    else
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+inline void heavy_fence()
+{
+#if defined(__linux__) && defined(__NR_membarrier)
+    if (has_process_wide_barrier() && syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0) == 0)
+        return;
+#endif
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+} // namespace Details
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
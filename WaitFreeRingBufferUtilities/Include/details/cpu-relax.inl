@@ -0,0 +1,24 @@
+#pragma once
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define IYP_WAIT_FREE_RING_BUFFER_UTILITIES_HAS_MM_PAUSE
+#endif
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+namespace Details
+{
+inline void cpu_relax()
+{
+#if defined(IYP_WAIT_FREE_RING_BUFFER_UTILITIES_HAS_MM_PAUSE)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+} // namespace Details
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
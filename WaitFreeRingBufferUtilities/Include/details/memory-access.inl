@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define IYP_WAIT_FREE_RING_BUFFER_UTILITIES_HAS_STREAMING_STORES
+#endif
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+namespace Details
+{
+enum : std::size_t
+{
+    CACHE_LINE_SIZE = 64,
+};
+
+inline void prefetch_for_read(const void *const address, const std::size_t size)
+{
+#if defined(__GNUC__)
+    for (std::size_t offset = 0; offset < size; offset += CACHE_LINE_SIZE)
+        __builtin_prefetch(static_cast<const char *>(address) + offset, 0, 3);
+#elif defined(IYP_WAIT_FREE_RING_BUFFER_UTILITIES_HAS_STREAMING_STORES)
+    for (std::size_t offset = 0; offset < size; offset += CACHE_LINE_SIZE)
+        _mm_prefetch(static_cast<const char *>(address) + offset, _MM_HINT_T0);
+#else
+    static_cast<void>(address);
+    static_cast<void>(size);
+#endif
+}
+
+inline void prefetch_for_write(const void *const address, const std::size_t size)
+{
+#if defined(__GNUC__)
+    for (std::size_t offset = 0; offset < size; offset += CACHE_LINE_SIZE)
+        __builtin_prefetch(static_cast<const char *>(address) + offset, 1, 3);
+#else
+    prefetch_for_read(address, size);
+#endif
+}
+
+// Copies with non-temporal stores that bypass the cache, followed by a store fence so that a later release store publishes
+// them. Falls back to memcpy for the parts that are not 16 byte aligned, or when streaming stores are not available.
+inline void streaming_copy(void *const destination, const void *const source, const std::size_t size)
+{
+#if defined(IYP_WAIT_FREE_RING_BUFFER_UTILITIES_HAS_STREAMING_STORES)
+    unsigned char *target = static_cast<unsigned char *>(destination);
+    const unsigned char *origin = static_cast<const unsigned char *>(source);
+    std::size_t remaining_size = size;
+
+    const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(target) & 15;
+    if (misalignment)
+    {
+        const std::size_t head_size = (16 - misalignment) < remaining_size ? (16 - misalignment) : remaining_size;
+        std::memcpy(target, origin, head_size);
+        target += head_size;
+        origin += head_size;
+        remaining_size -= head_size;
+    }
+
+#if defined(__AVX__)
+    if (!(reinterpret_cast<std::uintptr_t>(target) & 31))
+        for (; remaining_size >= 32; target += 32, origin += 32, remaining_size -= 32)
+            _mm256_stream_si256(reinterpret_cast<__m256i *>(target), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(origin)));
+#endif
+    for (; remaining_size >= 16; target += 16, origin += 16, remaining_size -= 16)
+        _mm_stream_si128(reinterpret_cast<__m128i *>(target), _mm_loadu_si128(reinterpret_cast<const __m128i *>(origin)));
+
+    std::memcpy(target, origin, remaining_size);
+    _mm_sfence();
+#else
+    std::memcpy(destination, source, size);
+#endif
+}
+} // namespace Details
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
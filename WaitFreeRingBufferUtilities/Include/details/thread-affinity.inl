@@ -0,0 +1,33 @@
+#pragma once
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <cstddef>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+namespace Details
+{
+inline bool pin_current_thread_to_cpu(const std::size_t cpu)
+{
+#ifdef __linux__
+    if (cpu >= CPU_SETSIZE)
+        return false;
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+    static_cast<void>(cpu);
+    return false;
+#endif
+}
+} // namespace Details
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/single-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/single-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
+
+#include <cstdint>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+namespace Private
+{
+template <typename Request>
+struct Submission
+{
+    std::uint64_t correlation_id;
+    Request request;
+
+    template <typename... Args>
+    explicit Submission(const std::uint64_t i_correlation_id, Args &&...args) : correlation_id(i_correlation_id),
+                                                                                 request(std::forward<Args>(args)...)
+    {
+    }
+};
+
+template <typename Response>
+struct ResponseSlot
+{
+    typename std::aligned_storage<sizeof(Response), alignof(Response)>::type storage;
+
+    Response &response()
+    {
+        return *reinterpret_cast<Response *>(&storage);
+    }
+};
+} // namespace Private
+
+// Request/response channel between one client thread and one server thread, in the style of io_uring. The client submits
+// requests on a submission ring and reaps completions from a completion ring, the server serves submissions in batches. Responses
+// are written in place into a preallocated table of Depth slots, and completions only carry the correlation id of the slot, so a
+// round trip takes no locks and no allocations.
+template <typename Request, typename Response, std::size_t Depth>
+class DuplexChannel
+{
+    enum : std::uint64_t
+    {
+        SLOT_MASK = Depth - 1,
+        NO_RESPONSE_FLAG = std::uint64_t(1) << 63, // Set in the completions of requests whose handler threw.
+    };
+    static_assert(Depth && !(SLOT_MASK & Depth), "Depth should be a power of two.");
+    static_assert(Depth <= std::numeric_limits<std::uint32_t>::max(), "Depth should fit in a std::uint32_t.");
+
+    RingBuffer<SingleProducer, SingleConsumer, Private::Submission<Request>, Depth> submissions;
+    RingBuffer<SingleProducer, SingleConsumer, std::uint64_t, Depth> completions;
+    std::array<Details::CacheAlignedAndPaddedObject<Private::ResponseSlot<Response>>, Depth> response_slots;
+
+    // Client side state. Correlation ids combine the slot index with a submission sequence number, so ids are never reused.
+    struct ClientState
+    {
+        std::array<std::uint32_t, Depth> free_slots;
+        std::size_t free_slot_count{Depth};
+        std::uint64_t next_sequence{0};
+    };
+
+    Details::CacheAlignedAndPaddedObject<ClientState> client_state;
+
+    // Server side state. Completions of the batch being served wait here until the whole batch is done.
+    struct ServerState
+    {
+        std::array<std::uint64_t, Depth> completed_ids;
+    };
+
+    Details::CacheAlignedAndPaddedObject<ServerState> server_state;
+
+    void publish_completions(const std::size_t count)
+    {
+        ServerState &state = server_state;
+        for (std::size_t i = 0; i < count; i++)
+            completions.push(state.completed_ids[i]);
+    }
+
+public:
+    enum : std::uint64_t
+    {
+        INVALID_CORRELATION_ID = std::numeric_limits<std::uint64_t>::max(),
+    };
+
+    DuplexChannel()
+    {
+        ClientState &state = client_state;
+        for (std::size_t i = 0; i < Depth; i++)
+            state.free_slots[i] = static_cast<std::uint32_t>(Depth - 1 - i);
+    }
+
+    DuplexChannel(const DuplexChannel &) = delete;
+    DuplexChannel(DuplexChannel &&) = delete;
+
+    DuplexChannel &operator=(const DuplexChannel &) = delete;
+    DuplexChannel &operator=(DuplexChannel &&) = delete;
+
+    // Client thread. Returns the correlation id of the request, or INVALID_CORRELATION_ID if Depth requests are outstanding.
+    template <typename... Args>
+    std::uint64_t submit(Args &&...args)
+    {
+        ClientState &state = client_state;
+        if (!state.free_slot_count)
+            return INVALID_CORRELATION_ID;
+
+        const std::uint32_t slot_index = state.free_slots[--state.free_slot_count];
+        const std::uint64_t correlation_id = (state.next_sequence++ * Depth) | slot_index;
+
+        // A free response slot means that fewer than Depth requests are outstanding, so there is room in both rings.
+        submissions.push(correlation_id, std::forward<Args>(args)...);
+        return correlation_id;
+    }
+
+    // Client thread. Submits requests[0, count) until Depth requests are outstanding, writes their correlation ids to
+    // correlation_ids, and returns how many were submitted.
+    std::size_t submit_batch(const Request *const requests, const std::size_t count, std::uint64_t *const correlation_ids)
+    {
+        ClientState &state = client_state;
+        const std::size_t submitted_count = std::min(count, state.free_slot_count);
+        for (std::size_t i = 0; i < submitted_count; i++)
+            correlation_ids[i] = submit(requests[i]);
+        return submitted_count;
+    }
+
+    // Client thread. Calls function(std::uint64_t correlation_id, Response &) for at most max_count completed requests, and returns
+    // how many were reaped. Requests whose handler threw in serve() are reaped and counted without calling function.
+    template <typename Function>
+    std::size_t reap(Function &&function, const std::size_t max_count = Depth)
+    {
+        ClientState &state = client_state;
+        std::size_t reaped_count = 0;
+
+        for (; reaped_count < max_count; reaped_count++)
+        {
+            const auto correlation_id = completions.pop();
+            if (!correlation_id)
+                break;
+
+            const std::uint32_t slot_index = static_cast<std::uint32_t>(*correlation_id & SLOT_MASK);
+            if (!(*correlation_id & NO_RESPONSE_FLAG))
+            {
+                auto &slot = response_slots[slot_index];
+                function(*correlation_id, slot.response());
+                slot.response().~Response();
+            }
+
+            state.free_slots[state.free_slot_count++] = slot_index;
+        }
+
+        return reaped_count;
+    }
+
+    // Server thread. Takes at most max_count submissions, calls function(Request &) -> Response for each one, and then publishes
+    // their completions. Returns how many requests were served. If function throws, the batch served so far is published together
+    // with the slot of the failed request, and the exception is rethrown. If taking a submission throws, only the batch so far is
+    // published.
+    template <typename Function>
+    std::size_t serve(Function &&function, const std::size_t max_count = Depth)
+    {
+        ServerState &state = server_state;
+        const std::size_t batch_size = std::min(max_count, static_cast<std::size_t>(Depth));
+        std::size_t served_count = 0;
+        bool has_current_submission = false;
+
+        try
+        {
+            for (; served_count < batch_size; served_count++)
+            {
+                auto submission = submissions.pop();
+                if (!submission)
+                    break;
+
+                state.completed_ids[served_count] = submission->correlation_id | NO_RESPONSE_FLAG;
+                has_current_submission = true;
+                auto &slot = response_slots[submission->correlation_id & SLOT_MASK];
+                new (&slot.storage) Response(function(submission->request));
+                state.completed_ids[served_count] = submission->correlation_id;
+                has_current_submission = false;
+            }
+        }
+        catch (...)
+        {
+            publish_completions(served_count + has_current_submission);
+            throw;
+        }
+
+        publish_completions(served_count);
+        return served_count;
+    }
+
+    ~DuplexChannel()
+    {
+        while (const auto correlation_id = completions.pop())
+            if (!(*correlation_id & NO_RESPONSE_FLAG))
+                response_slots[*correlation_id & SLOT_MASK].response().~Response();
+    }
+};
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/asymmetric-fence.inl"
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+#ifdef __linux__
+// Wraps a consumer policy so that the ring signals an eventfd when a consumer is waiting for it. The consumer arms the
+// notifier in acknowledge(), and only the first push after that pays for a write() until it is armed again. The fence pair
+// between them is asymmetric, pushes only pay for a compiler barrier and acknowledge() for the process wide one.
+// Usage: RingBuffer<MultiProducer, EventNotifyingConsumer<SingleConsumer>::Policy, ElementType, Count>
+template <template <typename, std::size_t> class Consumer>
+struct EventNotifyingConsumer
+{
+    template <typename ElementType, std::size_t Count>
+    class Policy : public Consumer<ElementType, Count>
+    {
+        const int file_descriptor{::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)};
+        Details::CacheAlignedAndPaddedObject<std::atomic_bool> armed{true};
+
+    public:
+        Policy() = default;
+
+        Policy(const Policy &) = delete;
+        Policy(Policy &&) = delete;
+
+        Policy &operator=(const Policy &) = delete;
+        Policy &operator=(Policy &&) = delete;
+
+        ~Policy()
+        {
+            if (file_descriptor >= 0)
+                ::close(file_descriptor);
+        }
+
+        template <typename Ring>
+        void notify_push(Ring &ring)
+        {
+            Consumer<ElementType, Count>::notify_push(ring);
+
+            // Pairs with the fence in acknowledge(): either the consumer sees this element after arming, or it is signalled.
+            Details::light_fence();
+            if (armed.load(std::memory_order_relaxed) && armed.exchange(false, std::memory_order_relaxed))
+            {
+                const std::uint64_t increment = 1;
+                const ssize_t written_size = ::write(file_descriptor, &increment, sizeof(increment));
+                static_cast<void>(written_size); // Only fails when the counter is about to overflow, it is readable then anyway.
+            }
+        }
+
+        int get_file_descriptor() const
+        {
+            return file_descriptor;
+        }
+
+        void acknowledge()
+        {
+            std::uint64_t counter;
+            const ssize_t read_size = ::read(file_descriptor, &counter, sizeof(counter));
+            static_cast<void>(read_size); // Fails with EAGAIN when there was no signal to consume.
+
+            armed.store(true, std::memory_order_relaxed);
+            Details::heavy_fence();
+        }
+    };
+};
+
+// RingBuffer whose consumers can wait in epoll/poll/select instead of spinning on pop(). Register file_descriptor() for
+// reading; once it is readable call acknowledge() and then pop until the ring is empty before waiting again.
+template <template <typename, std::size_t> class Producer,
+          template <typename, std::size_t> class Consumer,
+          typename ElementType, std::size_t Count>
+class EventNotifyingRingBuffer : Private::RingBufferTypeConstructor<Producer, EventNotifyingConsumer<Consumer>::template Policy, ElementType, Count>
+{
+    using Parrent = Private::RingBufferTypeConstructor<Producer, EventNotifyingConsumer<Consumer>::template Policy, ElementType, Count>;
+
+public:
+    using Parrent::push;
+    using Parrent::pop;
+
+    // Negative if the eventfd could not be created, in which case the ring still works but never signals.
+    int file_descriptor() const
+    {
+        return this->get_file_descriptor();
+    }
+
+    using Parrent::acknowledge;
+};
+#endif
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/optional-type.inl"
+
+#include <utility>
+#include <cstddef>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+// A per-thread handle to a ring with a MultiProducer, that takes push credits (and tickets, if the consumer can skip unfilled
+// ones) from the shared counters a batch at a time. Credits that are still held keep other producers from using those slots, so
+// flush() an idle handle. Destroying the handle flushes it.
+template <typename Ring>
+class ProducerHandle
+{
+    Ring &ring;
+    const std::size_t batch_size;
+    std::size_t credit_count{0};
+    std::size_t ticket_count{0};
+    std::size_t next_ticket{0};
+
+public:
+    explicit ProducerHandle(Ring &i_ring, const std::size_t i_batch_size = 64) : ring(i_ring),
+                                                                                 batch_size(i_batch_size)
+    {
+    }
+
+    ProducerHandle(const ProducerHandle &) = delete;
+    ProducerHandle &operator=(const ProducerHandle &) = delete;
+
+    template <typename... Args>
+    bool push(Args &&...args)
+    {
+        if (!credit_count)
+        {
+            credit_count = ring.reserve_push_credits(batch_size);
+            if (!credit_count)
+                return false;
+
+            if (Ring::TOLERATES_SKIPPED_TICKETS)
+            {
+                next_ticket = ring.reserve_push_tickets(credit_count);
+                ticket_count = credit_count;
+            }
+        }
+
+        std::size_t ticket;
+        if (ticket_count)
+        {
+            ticket = next_ticket++;
+            ticket_count--;
+        }
+        else
+            ticket = ring.reserve_push_tickets(1);
+
+        credit_count--;
+        ring.push_reserved(ticket, std::forward<Args>(args)...);
+        return true;
+    }
+
+    void flush()
+    {
+        if (credit_count)
+            ring.release_push_credits(credit_count);
+
+        credit_count = 0;
+        ticket_count = 0;
+    }
+
+    ~ProducerHandle()
+    {
+        flush();
+    }
+};
+
+// A per-thread handle to a ring with a MultiConsumer, that takes pop credits and tickets from the shared counters a batch at a
+// time. Elements covered by held credits are invisible to the other consumers, so flush() an idle handle. Destroying the handle
+// flushes it.
+template <typename Ring>
+class ConsumerHandle
+{
+    Ring &ring;
+    const std::size_t batch_size;
+    std::size_t credit_count{0};
+    std::size_t next_ticket{0};
+
+public:
+    explicit ConsumerHandle(Ring &i_ring, const std::size_t i_batch_size = 64) : ring(i_ring),
+                                                                                 batch_size(i_batch_size)
+    {
+    }
+
+    ConsumerHandle(const ConsumerHandle &) = delete;
+    ConsumerHandle &operator=(const ConsumerHandle &) = delete;
+
+    auto pop() -> decltype(std::declval<Ring &>().pop())
+    {
+        if (!credit_count)
+        {
+            credit_count = ring.reserve_pop_credits(batch_size);
+            if (!credit_count)
+                return decltype(std::declval<Ring &>().pop()){};
+
+            next_ticket = ring.reserve_pop_tickets(credit_count);
+        }
+
+        credit_count--;
+        return ring.pop_reserved(next_ticket++);
+    }
+
+    void flush()
+    {
+        if (credit_count)
+            ring.release_pop_credits(credit_count);
+
+        credit_count = 0;
+    }
+
+    ~ConsumerHandle()
+    {
+        flush();
+    }
+};
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
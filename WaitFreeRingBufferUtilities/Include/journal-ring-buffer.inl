@@ -0,0 +1,361 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/optional-type.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <type_traits>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+#ifdef __linux__
+enum class JournalFlushPolicy
+{
+    NONE,      // Left to the kernel. Survives the process dying, not the machine.
+    PERIODIC,  // A background thread calls msync every flush period.
+    PER_BATCH, // Every push() or push_batch() call is on disk when it returns.
+};
+
+namespace Private
+{
+static constexpr char JOURNAL_MAGIC[8] = {'R', 'I', 'N', 'G', 'J', 'R', 'N', '\0'};
+
+enum : std::uint32_t
+{
+    JOURNAL_VERSION = 2,
+};
+
+enum : std::size_t
+{
+    JOURNAL_PAGE_SIZE = 4096, // The smallest page size, slots never cross a multiple of it.
+};
+
+// Writes a range of the mapping back to the file. A template parameter of the journal, so that tests can make syncs fail.
+struct MsyncFileSync
+{
+    static bool sync(void *const address, const std::size_t size)
+    {
+        return ::msync(address, size, MS_SYNC) == 0;
+    }
+};
+
+struct JournalHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t element_size;
+    std::uint64_t count;
+};
+
+template <typename ElementType>
+struct UnpaddedJournalSlot
+{
+    std::atomic<std::uint64_t> commit_sequence;
+    ElementType value;
+};
+
+constexpr std::size_t next_power_of_two(const std::size_t value, const std::size_t power = 1)
+{
+    return power >= value ? power : next_power_of_two(value, power * 2);
+}
+
+// A slot is committed for ticket t once its commit_sequence is t + 1. The sequence is written after the value, and slots are padded
+// to a power of two so that none crosses a page: a page is written back as a whole, so a slot found committed after a crash, power
+// loss included, holds a complete element.
+template <typename ElementType>
+struct alignas(next_power_of_two(sizeof(UnpaddedJournalSlot<ElementType>))) JournalSlot : UnpaddedJournalSlot<ElementType>
+{
+};
+
+// The file is this struct, mapped as is. A new file is zero filled, which reads as an empty journal at ticket 0 once the header
+// is written.
+template <typename ElementType, std::size_t Count>
+struct JournalLayout
+{
+    JournalHeader header;
+    alignas(Details::DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<std::uint64_t> producer_cursor;
+    alignas(Details::DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<std::uint64_t> consumer_cursor;
+    alignas(JOURNAL_PAGE_SIZE) JournalSlot<ElementType> slots[Count];
+};
+} // namespace Private
+
+// Single producer single consumer ring kept in a memory mapped file, so that elements pushed but not yet popped when the process
+// dies are popped again after it restarts. Open the same path with the same ElementType and Count to recover them.
+//
+// Both cursors are kept in the file. On open the journal trusts the per-slot commit markers over the consumer cursor: it pops on
+// from the consumer cursor, or from the oldest ticket the markers allow if the cursor is stale, and takes every consecutive committed
+// slot after it as pushed. The consumer cursor only reaches the disk with the flushes, so after a power loss elements popped since the
+// last flush are popped a second time.
+template <typename ElementType, std::size_t Count, typename FileSync = Private::MsyncFileSync>
+class JournalRingBuffer
+{
+    static_assert(std::is_trivially_copyable<ElementType>::value, "Journal elements are stored as raw bytes.");
+
+    enum : std::size_t
+    {
+        COUNT_MASK = Count - 1,
+    };
+    static_assert(Count && !(COUNT_MASK & Count), "Count should be a power of two.");
+    static_assert(sizeof(Private::JournalSlot<ElementType>) <= Private::JOURNAL_PAGE_SIZE, "A journal slot should fit in a 4 KiB page.");
+
+    using Layout = Private::JournalLayout<ElementType, Count>;
+
+    struct ProducerState
+    {
+        std::uint64_t cursor{0};
+        std::uint64_t cached_consumer_cursor{0};
+    };
+
+    struct ConsumerState
+    {
+        std::uint64_t cursor{0};
+    };
+
+    Details::CacheAlignedAndPaddedObject<ProducerState> producer_state;
+    Details::CacheAlignedAndPaddedObject<ConsumerState> consumer_state;
+
+    const JournalFlushPolicy flush_policy;
+    int file_descriptor{-1};
+    Layout *layout{nullptr};
+    std::size_t initially_recovered_count{0};
+    std::atomic_bool has_failed_flush{false};
+
+    std::atomic_bool should_stop{false};
+    std::thread flusher;
+
+    bool map(const char *const path)
+    {
+        file_descriptor = ::open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (file_descriptor < 0)
+            return false;
+
+        struct stat file_status;
+        if (::fstat(file_descriptor, &file_status) != 0)
+            return false;
+
+        const bool is_new = file_status.st_size == 0;
+        if (is_new ? ::ftruncate(file_descriptor, sizeof(Layout)) != 0 : file_status.st_size != static_cast<off_t>(sizeof(Layout)))
+            return false;
+
+        void *const memory = ::mmap(nullptr, sizeof(Layout), PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+        if (memory == MAP_FAILED)
+            return false;
+        layout = static_cast<Layout *>(memory);
+
+        auto &header = layout->header;
+        if (is_new)
+        {
+            std::memcpy(header.magic, Private::JOURNAL_MAGIC, sizeof(header.magic));
+            header.version = Private::JOURNAL_VERSION;
+            header.element_size = sizeof(ElementType);
+            header.count = Count;
+            return FileSync::sync(layout, sizeof(Layout));
+        }
+
+        return std::memcmp(header.magic, Private::JOURNAL_MAGIC, sizeof(header.magic)) == 0 &&
+               header.version == Private::JOURNAL_VERSION &&
+               header.element_size == sizeof(ElementType) &&
+               header.count == Count;
+    }
+
+    // The cursor and the slots reach the disk in no particular order, so the consumer cursor found there can be older than a slot
+    // the producer already reused. A slot holding ticket t means the consumer had passed t - Count when it was written, so the
+    // scan skips forward to there instead of stopping.
+    void recover()
+    {
+        std::uint64_t consumer_cursor = layout->consumer_cursor.load(std::memory_order_relaxed);
+        std::uint64_t producer_cursor = consumer_cursor;
+        while (producer_cursor - consumer_cursor < Count)
+        {
+            const std::uint64_t commit_sequence = layout->slots[producer_cursor & COUNT_MASK].commit_sequence.load(std::memory_order_relaxed);
+            if (commit_sequence == producer_cursor + 1)
+                producer_cursor++;
+            else if (commit_sequence > producer_cursor + 1)
+                consumer_cursor = producer_cursor = commit_sequence - Count;
+            else
+                break;
+        }
+        layout->consumer_cursor.store(consumer_cursor, std::memory_order_relaxed);
+
+        layout->producer_cursor.store(producer_cursor, std::memory_order_relaxed);
+        producer_state.cursor = producer_cursor;
+        producer_state.cached_consumer_cursor = consumer_cursor;
+        consumer_state.cursor = consumer_cursor;
+        initially_recovered_count = static_cast<std::size_t>(producer_cursor - consumer_cursor);
+    }
+
+    // msync wants page aligned addresses. Failures are remembered for has_flush_failed().
+    bool sync(const void *const begin, const void *const end)
+    {
+        static const std::uintptr_t page_size = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+        const std::uintptr_t aligned_begin = reinterpret_cast<std::uintptr_t>(begin) & ~(page_size - 1);
+        if (FileSync::sync(reinterpret_cast<void *>(aligned_begin), reinterpret_cast<std::uintptr_t>(end) - aligned_begin))
+            return true;
+
+        has_failed_flush.store(true, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Syncs the cursors, then the slots of tickets [first, last). Writeback may still have put a slot on disk before the cursor
+    // that allowed it, which recover() copes with.
+    bool sync_tickets(const std::uint64_t first, const std::uint64_t last)
+    {
+        bool is_synced = sync(&layout->producer_cursor, &layout->consumer_cursor + 1);
+        if (first == last)
+            return is_synced;
+
+        const std::size_t first_index = first & COUNT_MASK;
+        const std::size_t last_index = ((last - 1) & COUNT_MASK) + 1;
+        if (first_index < last_index)
+            return sync(&layout->slots[first_index], &layout->slots[last_index]) && is_synced;
+
+        // The tickets wrap around the end of the ring.
+        is_synced = sync(&layout->slots[first_index], &layout->slots[Count]) && is_synced;
+        return sync(&layout->slots[0], &layout->slots[last_index]) && is_synced;
+    }
+
+    bool try_push(const ElementType &element)
+    {
+        auto &state = producer_state;
+        if (state.cursor - state.cached_consumer_cursor >= Count)
+        {
+            state.cached_consumer_cursor = layout->consumer_cursor.load(std::memory_order_acquire);
+            if (state.cursor - state.cached_consumer_cursor >= Count)
+                return false;
+        }
+
+        auto &slot = layout->slots[state.cursor & COUNT_MASK];
+        std::memcpy(&slot.value, &element, sizeof(ElementType));
+        slot.commit_sequence.store(state.cursor + 1, std::memory_order_release);
+        state.cursor++;
+        return true;
+    }
+
+public:
+    // Opens the journal at path, creating it if it does not exist. Check is_open() before using it: opening fails if the file
+    // cannot be mapped or was created for another ElementType or Count, and the file is left untouched then.
+    explicit JournalRingBuffer(const char *const path,
+                               const JournalFlushPolicy i_flush_policy = JournalFlushPolicy::NONE,
+                               const std::chrono::milliseconds flush_period = std::chrono::milliseconds(10)) : flush_policy(i_flush_policy)
+    {
+        if (!map(path))
+        {
+            if (layout)
+                ::munmap(layout, sizeof(Layout));
+            layout = nullptr;
+            return;
+        }
+
+        recover();
+
+        if (flush_policy == JournalFlushPolicy::PERIODIC)
+            flusher = std::thread([this, flush_period]() {
+                while (!should_stop.load(std::memory_order_acquire))
+                {
+                    std::this_thread::sleep_for(flush_period);
+                    flush();
+                }
+            });
+    }
+
+    JournalRingBuffer(const JournalRingBuffer &) = delete;
+    JournalRingBuffer(JournalRingBuffer &&) = delete;
+
+    JournalRingBuffer &operator=(const JournalRingBuffer &) = delete;
+    JournalRingBuffer &operator=(JournalRingBuffer &&) = delete;
+
+    ~JournalRingBuffer()
+    {
+        should_stop.store(true, std::memory_order_release);
+        if (flusher.joinable())
+            flusher.join();
+
+        if (layout)
+        {
+            if (flush_policy != JournalFlushPolicy::NONE)
+                flush();
+            ::munmap(layout, sizeof(Layout));
+        }
+        if (file_descriptor >= 0)
+            ::close(file_descriptor);
+    }
+
+    bool is_open() const
+    {
+        return layout != nullptr;
+    }
+
+    // Number of elements that were pushed but not popped when the journal was last closed.
+    std::size_t recovered_count() const
+    {
+        return initially_recovered_count;
+    }
+
+    bool push(const ElementType &element)
+    {
+        return push_batch(&element, 1) == 1;
+    }
+
+    // Pushes as many of the elements as fit and returns how many did. With JournalFlushPolicy::PER_BATCH they are synced once
+    // for the whole batch; if that sync fails the elements stay pushed, but has_flush_failed() turns true.
+    std::size_t push_batch(const ElementType *const elements, const std::size_t element_count)
+    {
+        const std::uint64_t first_ticket = producer_state.cursor;
+
+        std::size_t pushed_count = 0;
+        while (pushed_count < element_count && try_push(elements[pushed_count]))
+            pushed_count++;
+
+        if (pushed_count)
+        {
+            layout->producer_cursor.store(producer_state.cursor, std::memory_order_release);
+            if (flush_policy == JournalFlushPolicy::PER_BATCH)
+                sync_tickets(first_ticket, producer_state.cursor);
+        }
+        return pushed_count;
+    }
+
+    OptionalType<ElementType> pop()
+    {
+        auto &state = consumer_state;
+        auto &slot = layout->slots[state.cursor & COUNT_MASK];
+        if (slot.commit_sequence.load(std::memory_order_acquire) != state.cursor + 1)
+            return OptionalType<ElementType>{};
+
+        typename std::aligned_storage<sizeof(ElementType), alignof(ElementType)>::type storage;
+        std::memcpy(&storage, &slot.value, sizeof(ElementType));
+        layout->consumer_cursor.store(++state.cursor, std::memory_order_release);
+        return *reinterpret_cast<ElementType *>(&storage);
+    }
+
+    // Syncs the whole journal, cursors included. Safe to call from any thread.
+    bool flush()
+    {
+        return sync(layout, layout + 1);
+    }
+
+    // Whether any sync failed since the journal was opened, e.g. with EIO or ENOSPC. Elements pushed since then may not be on disk
+    // even under JournalFlushPolicy::PER_BATCH.
+    bool has_flush_failed() const
+    {
+        return has_failed_flush.load(std::memory_order_relaxed);
+    }
+};
+#endif
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/multi-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/single-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
+
+#include <cstdint>
+#include <utility>
+#include <cstddef>
+#include <atomic>
+#include <array>
+#include <functional>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+namespace Private
+{
+template <typename Key, typename Value>
+struct KeyedMessage
+{
+    std::size_t bucket_index;
+    Key key;
+    Value value;
+
+    template <typename K, typename V>
+    KeyedMessage(const std::size_t i_bucket_index, K &&i_key, V &&i_value) : bucket_index(i_bucket_index),
+                                                                             key(std::forward<K>(i_key)),
+                                                                             value(std::forward<V>(i_value))
+    {
+    }
+};
+} // namespace Private
+
+struct LaneStatistics
+{
+    std::size_t occupancy;       // Messages pushed to the lane and not yet consumed.
+    std::size_t processed_count; // Messages consumed from the lane since construction.
+    std::size_t bucket_count;    // Key buckets currently routed to the lane.
+};
+
+// Routes (key, value) messages onto LaneCount MultiProducer/SingleConsumer lanes, each drained by one consumer, so that messages
+// with the same key are consumed in the order they were pushed. Keys are hashed onto BucketCount buckets, and each bucket is
+// routed to one lane. rebalance() moves buckets away from busy lanes, but only while none of their messages are queued or being
+// consumed, which keeps the per-key order.
+template <typename Key, typename Value, std::size_t LaneCount, std::size_t LaneSize, std::size_t BucketCount = 1024, typename Hash = std::hash<Key>>
+class KeyedDispatcher
+{
+    static_assert(LaneCount > 0, "At least one lane is required.");
+    static_assert(BucketCount >= LaneCount, "Every lane should have a bucket to start with.");
+
+    using Message = Private::KeyedMessage<Key, Value>;
+    using Lane = RingBuffer<MultiProducer, SingleConsumer, Message, LaneSize>;
+
+    enum : std::uint64_t
+    {
+        LANE_SHIFT = 32,
+        IN_FLIGHT_MASK = (std::uint64_t(1) << LANE_SHIFT) - 1,
+    };
+
+    // The lane and the number of in flight messages share one word, so a producer reads the lane and pins the bucket to it with a
+    // single fetch_add, and rebalancing can only swap the lane while the count is zero.
+    struct Bucket
+    {
+        std::atomic<std::uint64_t> word;
+        std::atomic_size_t processed_count;
+    };
+
+    Hash hash;
+    std::array<Lane, LaneCount> lanes;
+    std::array<Details::CacheAlignedAndPaddedObject<Bucket>, BucketCount> buckets;
+    std::array<Details::CacheAlignedAndPaddedObject<std::atomic_size_t>, LaneCount> processed_counts;
+
+    std::atomic_flag is_rebalancing = ATOMIC_FLAG_INIT;
+    std::array<std::size_t, BucketCount> last_processed_counts{};
+
+    std::size_t bucket_index_of(const Key &key) const
+    {
+        return hash(key) % BucketCount;
+    }
+
+public:
+    explicit KeyedDispatcher(Hash i_hash = Hash{}) : hash(std::move(i_hash))
+    {
+        for (std::size_t i = 0; i < BucketCount; i++)
+        {
+            buckets[i].word.store(std::uint64_t(i % LaneCount) << LANE_SHIFT, std::memory_order_relaxed);
+            buckets[i].processed_count.store(0, std::memory_order_relaxed);
+        }
+        for (auto &processed_count : processed_counts)
+            processed_count.store(0, std::memory_order_relaxed);
+    }
+
+    KeyedDispatcher(const KeyedDispatcher &) = delete;
+    KeyedDispatcher(KeyedDispatcher &&) = delete;
+
+    KeyedDispatcher &operator=(const KeyedDispatcher &) = delete;
+    KeyedDispatcher &operator=(KeyedDispatcher &&) = delete;
+
+    // Returns false if the lane of the key is full.
+    template <typename K, typename V>
+    bool push(K &&key, V &&value)
+    {
+        const std::size_t bucket_index = bucket_index_of(key);
+        auto &bucket = buckets[bucket_index];
+
+        const std::uint64_t word = bucket.word.fetch_add(1, std::memory_order_acquire);
+        if (lanes[word >> LANE_SHIFT].push(bucket_index, std::forward<K>(key), std::forward<V>(value)))
+            return true;
+
+        bucket.word.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+
+    // Calls function(const Key &, Value &) with the front message of the lane. Should only be called by the lane's consumer.
+    template <typename Function>
+    bool consume(const std::size_t lane_index, Function &&function)
+    {
+        auto message = lanes[lane_index].pop();
+        if (!message)
+            return false;
+
+        function(static_cast<const Key &>(message->key), message->value);
+
+        auto &bucket = buckets[message->bucket_index];
+        bucket.processed_count.fetch_add(1, std::memory_order_relaxed);
+        bucket.word.fetch_sub(1, std::memory_order_release);
+        processed_counts[lane_index].store(processed_counts[lane_index].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::size_t lane_of(const Key &key) const
+    {
+        return buckets[bucket_index_of(key)].word.load(std::memory_order_acquire) >> LANE_SHIFT;
+    }
+
+    // Moves at most one bucket from the lane that processed the most messages since the last call to the one that processed the
+    // least. Only buckets that were busy but carry at most half of the difference are moved, so a single hot key is not just moved
+    // around. Returns the number of moved buckets; concurrent calls return 0 right away.
+    std::size_t rebalance()
+    {
+        if (is_rebalancing.test_and_set(std::memory_order_acquire))
+            return 0;
+
+        std::array<std::size_t, BucketCount> deltas;
+        std::array<std::size_t, BucketCount> bucket_lanes;
+        std::array<std::size_t, LaneCount> lane_loads{};
+        for (std::size_t i = 0; i < BucketCount; i++)
+        {
+            const std::size_t processed_count = buckets[i].processed_count.load(std::memory_order_relaxed);
+            deltas[i] = processed_count - last_processed_counts[i];
+            last_processed_counts[i] = processed_count;
+
+            bucket_lanes[i] = buckets[i].word.load(std::memory_order_relaxed) >> LANE_SHIFT;
+            lane_loads[bucket_lanes[i]] += deltas[i];
+        }
+
+        std::size_t busiest_lane = 0;
+        std::size_t idlest_lane = 0;
+        for (std::size_t lane = 1; lane < LaneCount; lane++)
+        {
+            if (lane_loads[lane] > lane_loads[busiest_lane])
+                busiest_lane = lane;
+            if (lane_loads[lane] < lane_loads[idlest_lane])
+                idlest_lane = lane;
+        }
+
+        const std::size_t movable_load = (lane_loads[busiest_lane] - lane_loads[idlest_lane]) / 2;
+        std::size_t moved_count = 0;
+        while (true)
+        {
+            std::size_t candidate = BucketCount;
+            for (std::size_t i = 0; i < BucketCount; i++)
+                if (bucket_lanes[i] == busiest_lane && deltas[i] && deltas[i] <= movable_load && (candidate == BucketCount || deltas[i] > deltas[candidate]))
+                    candidate = i;
+
+            if (candidate == BucketCount)
+                break;
+
+            std::uint64_t idle_word = std::uint64_t(busiest_lane) << LANE_SHIFT;
+            if (buckets[candidate].word.compare_exchange_strong(idle_word, std::uint64_t(idlest_lane) << LANE_SHIFT, std::memory_order_acq_rel))
+            {
+                moved_count++;
+                break;
+            }
+            deltas[candidate] = 0; // It has messages in flight, try the next hottest one.
+        }
+
+        is_rebalancing.clear(std::memory_order_release);
+        return moved_count;
+    }
+
+    std::array<LaneStatistics, LaneCount> statistics() const
+    {
+        std::array<LaneStatistics, LaneCount> result{};
+        for (const auto &bucket : buckets)
+        {
+            const std::uint64_t word = bucket.word.load(std::memory_order_relaxed);
+            auto &lane_statistics = result[word >> LANE_SHIFT];
+            lane_statistics.occupancy += word & IN_FLIGHT_MASK;
+            lane_statistics.bucket_count++;
+        }
+        for (std::size_t lane = 0; lane < LaneCount; lane++)
+            result[lane].processed_count = processed_counts[lane].load(std::memory_order_relaxed);
+        return result;
+    }
+};
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
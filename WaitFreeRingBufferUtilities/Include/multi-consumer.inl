@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Iyp/WaitFreeRingBufferUtilities/optional-type.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/policy-configuration.inl"
 #include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
 
 #include <cstdint>
@@ -12,13 +13,18 @@ namespace Iyp
 {
 namespace WaitFreeRingBufferUtilities
 {
-template <typename ElementType, std::size_t Count>
-class MultiConsumer
+template <typename ElementType, std::size_t Count, typename Configuration>
+class BasicMultiConsumer
 {
     Details::CacheAlignedAndPaddedObject<std::atomic_size_t> begin{std::size_t(0)};
     Details::CacheAlignedAndPaddedObject<std::atomic<std::int64_t>> pop_task_count{std::int64_t{0}};
 
 public:
+    enum : bool
+    {
+        TOLERATES_SKIPPED_TICKETS = true, // Tickets that are never filled are skipped over by later pops.
+    };
+
     template <typename Ring>
     void notify_push(Ring &)
     {
@@ -34,14 +40,22 @@ public:
             return OptionalType<ElementType>{};
         }
 
+        return pop_reserved_impl(ring, begin.fetch_add(1, std::memory_order_relaxed));
+    }
+
+    // The caller must hold a credit obtained from reserve_pop_credits_impl.
+    template <typename Ring>
+    OptionalType<ElementType> pop_reserved_impl(Ring &ring, std::size_t ticket)
+    {
+        typename Configuration::WaitStrategy wait_strategy;
         while (true)
         {
-            const std::size_t element_index = begin.fetch_add(1, std::memory_order_relaxed) & Ring::COUNT_MASK;
-            auto &element = ring.elements[element_index];
+            auto &element = ring.elements[ticket & Ring::COUNT_MASK];
 
             std::uint_fast8_t expected_element_state = Private::ElementState::READY_FOR_POP;
             if (std::atomic_compare_exchange_strong(&element.state, &expected_element_state, std::uint_fast8_t(Private::ElementState::IN_PROGRESS)))
             {
+                Private::prefetch_element_for_pop<Configuration>(ring, ticket);
                 OptionalType<ElementType> result{std::move(*element.value_ptr)};
                 element.value_ptr->~ElementType();
 
@@ -49,9 +63,36 @@ public:
                 ring.notify_pop(ring);
                 return result;
             }
+
+            wait_strategy.wait();
+            ticket = begin.fetch_add(1, std::memory_order_relaxed);
         }
     }
+
+    std::size_t reserve_pop_credits_impl(const std::size_t count)
+    {
+        const std::int64_t requested = static_cast<std::int64_t>(count);
+        const std::int64_t available = pop_task_count.fetch_sub(requested, std::memory_order_acq_rel);
+        const std::int64_t granted = available <= std::int64_t(0) ? std::int64_t(0) : (available < requested ? available : requested);
+
+        if (granted < requested)
+            pop_task_count.fetch_add(requested - granted, std::memory_order_relaxed);
+        return static_cast<std::size_t>(granted);
+    }
+
+    std::size_t reserve_pop_tickets_impl(const std::size_t count)
+    {
+        return begin.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void release_pop_credits_impl(const std::size_t count)
+    {
+        pop_task_count.fetch_add(static_cast<std::int64_t>(count), std::memory_order_release);
+    }
 };
 
+template <typename ElementType, std::size_t Count>
+using MultiConsumer = BasicMultiConsumer<ElementType, Count, DefaultPolicyConfiguration>;
+
 } // namespace WaitFreeRingBufferUtilities
 } // namespace Iyp
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Iyp/WaitFreeRingBufferUtilities/optional-type.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/policy-configuration.inl"
 #include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
 
 #include <cstdint>
@@ -8,20 +9,49 @@
 #include <limits>
 #include <cstddef>
 #include <atomic>
+#include <type_traits>
 
 namespace Iyp
 {
 namespace WaitFreeRingBufferUtilities
 {
 
-template <typename ElementType, std::size_t Count>
-class MultiProducer
+template <typename ElementType, std::size_t Count, typename Configuration>
+class BasicMultiProducer
 {
     Details::CacheAlignedAndPaddedObject<std::atomic_size_t> end{std::size_t(0)};
     Details::CacheAlignedAndPaddedObject<std::atomic<std::int64_t>> push_task_count{static_cast<std::int64_t>(Count)};
     static_assert(Count <= static_cast<std::size_t>(std::numeric_limits<std::int64_t>::max()),
                   "Count exceeds the maximum. Count should fit in a std::int64_t.");
 
+    template <typename Ring, typename Element, typename... Args>
+    void construct_in_slot(std::true_type, Ring &, Element &element, Args &&...args)
+    {
+        element.value_ptr = Private::construct_element<Configuration, ElementType>(element.storage, std::forward<Args>(args)...);
+    }
+
+    // The ticket is spent by then, so the slot can only be left empty. Consumers that skip unfilled tickets get it back as free
+    // along with its credit; one that reads slots in order steps over it and frees it, which returns the credit through notify_pop.
+    template <typename Ring, typename Element, typename... Args>
+    void construct_in_slot(std::false_type, Ring &ring, Element &element, Args &&...args)
+    {
+        try
+        {
+            construct_in_slot(std::true_type{}, ring, element, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            if (Ring::TOLERATES_SKIPPED_TICKETS)
+            {
+                element.state.store(Private::ElementState::READY_FOR_PUSH, std::memory_order_release);
+                push_task_count.fetch_add(1, std::memory_order_release);
+            }
+            else
+                element.state.store(Private::ElementState::SKIPPED, std::memory_order_release);
+            throw;
+        }
+    }
+
 public:
     template <typename Ring>
     void notify_pop(const Ring &)
@@ -38,24 +68,60 @@ public:
             return false;
         }
 
+        push_reserved_impl(ring, end.fetch_add(1, std::memory_order_relaxed), std::forward<Args>(args)...);
+        return true;
+    }
+
+    // The caller must hold a credit obtained from reserve_push_credits_impl.
+    template <typename Ring, typename... Args>
+    void push_reserved_impl(Ring &ring, std::size_t ticket, Args &&...args)
+    {
+        typename Configuration::WaitStrategy wait_strategy;
         while (true)
         {
-            const std::size_t element_index = end.fetch_add(1, std::memory_order_relaxed) & Ring::COUNT_MASK;
-            auto &element = ring.elements[element_index];
+            auto &element = ring.elements[ticket & Ring::COUNT_MASK];
 
             std::uint_fast8_t expected_element_state = Private::ElementState::READY_FOR_PUSH;
             if (std::atomic_compare_exchange_strong(&element.state, &expected_element_state, std::uint_fast8_t(Private::ElementState::IN_PROGRESS)))
             {
-                element.value_ptr = new (&element.storage) ElementType(std::forward<Args>(args)...);
+                Private::prefetch_element_for_push<Configuration>(ring, ticket);
+                construct_in_slot(Private::IsNothrowConstruction<Configuration, ElementType, Args...>{}, ring, element, std::forward<Args>(args)...);
 
                 element.state.store(Private::ElementState::READY_FOR_POP, std::memory_order_release);
                 ring.notify_push(ring);
 
-                return true;
+                return;
             }
+
+            wait_strategy.wait();
+            ticket = end.fetch_add(1, std::memory_order_relaxed);
         }
     }
+
+    std::size_t reserve_push_credits_impl(const std::size_t count)
+    {
+        const std::int64_t requested = static_cast<std::int64_t>(count);
+        const std::int64_t available = push_task_count.fetch_sub(requested, std::memory_order_acq_rel);
+        const std::int64_t granted = available <= std::int64_t(0) ? std::int64_t(0) : (available < requested ? available : requested);
+
+        if (granted < requested)
+            push_task_count.fetch_add(requested - granted, std::memory_order_relaxed);
+        return static_cast<std::size_t>(granted);
+    }
+
+    std::size_t reserve_push_tickets_impl(const std::size_t count)
+    {
+        return end.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void release_push_credits_impl(const std::size_t count)
+    {
+        push_task_count.fetch_add(static_cast<std::int64_t>(count), std::memory_order_release);
+    }
 };
 
+template <typename ElementType, std::size_t Count>
+using MultiProducer = BasicMultiProducer<ElementType, Count, DefaultPolicyConfiguration>;
+
 } // namespace WaitFreeRingBufferUtilities
 } // namespace Iyp
@@ -0,0 +1,250 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
+
+#include <cstdint>
+#include <utility>
+#include <cstddef>
+#include <atomic>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+namespace Private
+{
+template <typename T, typename... Types>
+struct TypeIndex;
+
+template <typename T, typename... Types>
+struct TypeIndex<T, T, Types...> : std::integral_constant<std::size_t, 0>
+{
+};
+
+template <typename T, typename U, typename... Types>
+struct TypeIndex<T, U, Types...> : std::integral_constant<std::size_t, 1 + TypeIndex<T, Types...>::value>
+{
+};
+
+template <typename... Types>
+struct MaxAlignment;
+
+template <>
+struct MaxAlignment<> : std::integral_constant<std::size_t, 1>
+{
+};
+
+template <typename T, typename... Types>
+struct MaxAlignment<T, Types...> : std::integral_constant<std::size_t, (alignof(T) > MaxAlignment<Types...>::value) ? alignof(T) : MaxAlignment<Types...>::value>
+{
+};
+
+template <typename... Types>
+struct MaxSize;
+
+template <>
+struct MaxSize<> : std::integral_constant<std::size_t, 0>
+{
+};
+
+template <typename T, typename... Types>
+struct MaxSize<T, Types...> : std::integral_constant<std::size_t, (sizeof(T) > MaxSize<Types...>::value) ? sizeof(T) : MaxSize<Types...>::value>
+{
+};
+
+constexpr std::size_t round_up(const std::size_t value, const std::size_t multiple_of)
+{
+    return ((value + multiple_of - 1) / multiple_of) * multiple_of;
+}
+
+struct RecordHeader
+{
+    std::uint32_t record_size;
+    std::uint8_t type_index;
+};
+
+template <typename... Types>
+struct VisitRecord;
+
+template <>
+struct VisitRecord<>
+{
+    template <typename Visitor>
+    static void visit(std::size_t, void *, Visitor &)
+    {
+    }
+
+    static void destroy(std::size_t, void *)
+    {
+    }
+};
+
+template <typename T, typename... Types>
+struct VisitRecord<T, Types...>
+{
+    template <typename Visitor>
+    static void visit(const std::size_t type_index, void *const payload, Visitor &visitor)
+    {
+        if (type_index == 0)
+            visitor(*static_cast<T *>(payload));
+        else
+            VisitRecord<Types...>::visit(type_index - 1, payload, visitor);
+    }
+
+    static void destroy(const std::size_t type_index, void *const payload)
+    {
+        if (type_index == 0)
+            static_cast<T *>(payload)->~T();
+        else
+            VisitRecord<Types...>::destroy(type_index - 1, payload);
+    }
+};
+} // namespace Private
+
+// Single producer single consumer ring that stores each message at its own size, in contrast to RingBuffer whose slots are all
+// as large as the ElementType. Consumers visit messages in place.
+template <std::size_t CapacityInBytes, typename... Types>
+class MultiTypeRingBuffer
+{
+    static_assert(sizeof...(Types) > 0, "At least one message type is required.");
+    static_assert(sizeof...(Types) < std::numeric_limits<std::uint8_t>::max(), "Too many message types, the type tag is a std::uint8_t.");
+    static_assert(CapacityInBytes && !((CapacityInBytes - 1) & CapacityInBytes), "CapacityInBytes should be a power of two.");
+    static_assert(CapacityInBytes <= std::numeric_limits<std::uint32_t>::max(), "CapacityInBytes should fit in a std::uint32_t.");
+
+    enum : std::size_t
+    {
+        RECORD_GRANULARITY = Private::round_up(Private::MaxAlignment<Private::RecordHeader, Types...>::value, sizeof(Private::RecordHeader)),
+        PAYLOAD_OFFSET = Private::round_up(sizeof(Private::RecordHeader), Private::MaxAlignment<Types...>::value),
+        CAPACITY_MASK = CapacityInBytes - 1,
+        PADDING_TYPE_INDEX = sizeof...(Types),
+        // Records sit at multiples of RECORD_GRANULARITY, so the storage has to be aligned for the most aligned type too.
+        STORAGE_ALIGNMENT = Private::MaxAlignment<Private::RecordHeader, Types...>::value > Details::DESTRUCTIVE_INTERFERENCE_SIZE
+                                ? Private::MaxAlignment<Private::RecordHeader, Types...>::value
+                                : Details::DESTRUCTIVE_INTERFERENCE_SIZE,
+    };
+    static_assert(CapacityInBytes % RECORD_GRANULARITY == 0, "CapacityInBytes should be a multiple of the largest alignment.");
+    static_assert(PAYLOAD_OFFSET + Private::MaxSize<Types...>::value <= CapacityInBytes, "The largest message does not fit in the ring.");
+
+    template <typename T>
+    struct RecordSize : std::integral_constant<std::size_t, Private::round_up(PAYLOAD_OFFSET + sizeof(T), RECORD_GRANULARITY)>
+    {
+    };
+
+    struct ProducerState
+    {
+        std::size_t end{0};
+        std::size_t cached_begin{0};
+    };
+
+    struct ConsumerState
+    {
+        std::size_t begin{0};
+        std::size_t cached_end{0};
+    };
+
+    Details::CacheAlignedAndPaddedObject<ProducerState> producer_state;
+    Details::CacheAlignedAndPaddedObject<ConsumerState> consumer_state;
+    Details::CacheAlignedAndPaddedObject<std::atomic_size_t> published_end{std::size_t(0)};
+    Details::CacheAlignedAndPaddedObject<std::atomic_size_t> released_begin{std::size_t(0)};
+
+    alignas(STORAGE_ALIGNMENT) unsigned char storage[CapacityInBytes];
+
+    Private::RecordHeader &header_at(const std::size_t position)
+    {
+        return *reinterpret_cast<Private::RecordHeader *>(&storage[position & CAPACITY_MASK]);
+    }
+
+    void *payload_at(const std::size_t position)
+    {
+        return &storage[(position & CAPACITY_MASK) + PAYLOAD_OFFSET];
+    }
+
+public:
+    MultiTypeRingBuffer() = default;
+
+    MultiTypeRingBuffer(const MultiTypeRingBuffer &) = delete;
+    MultiTypeRingBuffer(MultiTypeRingBuffer &&) = delete;
+
+    MultiTypeRingBuffer &operator=(const MultiTypeRingBuffer &) = delete;
+    MultiTypeRingBuffer &operator=(MultiTypeRingBuffer &&) = delete;
+
+    template <typename T, typename... Args>
+    bool push(Args &&...args)
+    {
+        constexpr std::size_t type_index = Private::TypeIndex<T, Types...>::value;
+        constexpr std::size_t record_size = RecordSize<T>::value;
+
+        const std::size_t end = producer_state.end;
+        const std::size_t space_to_wrap = CapacityInBytes - (end & CAPACITY_MASK);
+        const std::size_t padding_size = space_to_wrap < record_size ? space_to_wrap : 0;
+        const std::size_t required_size = padding_size + record_size;
+
+        if (CapacityInBytes - (end - producer_state.cached_begin) < required_size)
+        {
+            producer_state.cached_begin = released_begin.load(std::memory_order_acquire);
+            if (CapacityInBytes - (end - producer_state.cached_begin) < required_size)
+                return false;
+        }
+
+        if (padding_size)
+        {
+            auto &padding_header = header_at(end);
+            padding_header.record_size = static_cast<std::uint32_t>(padding_size);
+            padding_header.type_index = PADDING_TYPE_INDEX;
+        }
+
+        const std::size_t record_position = end + padding_size;
+        new (payload_at(record_position)) T(std::forward<Args>(args)...);
+
+        auto &header = header_at(record_position);
+        header.record_size = static_cast<std::uint32_t>(record_size);
+        header.type_index = static_cast<std::uint8_t>(type_index);
+
+        producer_state.end = end + required_size;
+        published_end.store(producer_state.end, std::memory_order_release);
+        return true;
+    }
+
+    // Calls visitor with a T & for the front message, which may be moved from. Returns false if the ring is empty.
+    template <typename Visitor>
+    bool pop(Visitor &&visitor)
+    {
+        std::size_t begin = consumer_state.begin;
+
+        if (begin == consumer_state.cached_end)
+        {
+            consumer_state.cached_end = published_end.load(std::memory_order_acquire);
+            if (begin == consumer_state.cached_end)
+                return false;
+        }
+
+        if (header_at(begin).type_index == PADDING_TYPE_INDEX)
+            begin += header_at(begin).record_size;
+
+        const auto &header = header_at(begin);
+        void *const payload = payload_at(begin);
+        Private::VisitRecord<Types...>::visit(header.type_index, payload, visitor);
+        Private::VisitRecord<Types...>::destroy(header.type_index, payload);
+
+        consumer_state.begin = begin + header.record_size;
+        released_begin.store(consumer_state.begin, std::memory_order_release);
+        return true;
+    }
+
+    ~MultiTypeRingBuffer()
+    {
+        const std::size_t end = published_end.load(std::memory_order_acquire);
+        for (std::size_t begin = consumer_state.begin; begin != end; begin += header_at(begin).record_size)
+        {
+            const auto &header = header_at(begin);
+            if (header.type_index != PADDING_TYPE_INDEX)
+                Private::VisitRecord<Types...>::destroy(header.type_index, payload_at(begin));
+        }
+    }
+};
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
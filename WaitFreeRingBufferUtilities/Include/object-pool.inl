@@ -0,0 +1,236 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/multi-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/multi-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/handles.inl"
+
+#include <utility>
+#include <cstddef>
+#include <array>
+#include <new>
+#include <type_traits>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+template <typename Pool, std::size_t CacheSize>
+class ObjectPoolCache;
+
+// Fixed set of Count objects, constructed once and handed out again and again. The indices of the free objects are kept in a
+// MultiProducer/MultiConsumer RingBuffer, so acquire() and releasing a handle are wait-free. All handles should be released
+// before the pool is destroyed.
+template <typename T, std::size_t Count>
+class ObjectPool
+{
+    using FreeIndexRing = RingBuffer<MultiProducer, MultiConsumer, std::size_t, Count>;
+
+    template <typename Pool, std::size_t CacheSize>
+    friend class ObjectPoolCache;
+
+    FreeIndexRing free_indices;
+    std::array<typename std::aligned_storage<sizeof(T), alignof(T)>::type, Count> storage;
+
+    T &object_at(const std::size_t index)
+    {
+        return *reinterpret_cast<T *>(&storage[index]);
+    }
+
+    void release_index(const std::size_t index)
+    {
+        // There are as many slots in the ring as there are indices, so this push always finds a free slot.
+        free_indices.push(index);
+    }
+
+public:
+    // Move only owner of one pooled object. Destroying or resetting it returns the object to the pool.
+    class Handle
+    {
+        friend class ObjectPool;
+
+        template <typename Pool, std::size_t CacheSize>
+        friend class ObjectPoolCache;
+
+        ObjectPool *pool{nullptr};
+        std::size_t index{0};
+
+        Handle(ObjectPool &i_pool, const std::size_t i_index) : pool(&i_pool),
+                                                                 index(i_index)
+        {
+        }
+
+    public:
+        Handle() = default;
+
+        Handle(const Handle &) = delete;
+        Handle &operator=(const Handle &) = delete;
+
+        Handle(Handle &&other) noexcept : pool(other.pool),
+                                          index(other.index)
+        {
+            other.pool = nullptr;
+        }
+
+        Handle &operator=(Handle &&other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                pool = other.pool;
+                index = other.index;
+                other.pool = nullptr;
+            }
+            return *this;
+        }
+
+        ~Handle()
+        {
+            reset();
+        }
+
+        void reset()
+        {
+            if (pool)
+                pool->release_index(index);
+            pool = nullptr;
+        }
+
+        explicit operator bool() const
+        {
+            return pool != nullptr;
+        }
+
+        T *get() const
+        {
+            return pool ? &pool->object_at(index) : nullptr;
+        }
+
+        T &operator*() const
+        {
+            return pool->object_at(index);
+        }
+
+        T *operator->() const
+        {
+            return &pool->object_at(index);
+        }
+    };
+
+    // Every object is constructed from a copy of args.
+    template <typename... Args>
+    explicit ObjectPool(const Args &...args)
+    {
+        std::size_t constructed_count = 0;
+        try
+        {
+            for (; constructed_count < Count; constructed_count++)
+                new (&storage[constructed_count]) T(args...);
+        }
+        catch (...)
+        {
+            while (constructed_count)
+                object_at(--constructed_count).~T();
+            throw;
+        }
+
+        for (std::size_t index = 0; index < Count; index++)
+            free_indices.push(index);
+    }
+
+    ObjectPool(const ObjectPool &) = delete;
+    ObjectPool(ObjectPool &&) = delete;
+
+    ObjectPool &operator=(const ObjectPool &) = delete;
+    ObjectPool &operator=(ObjectPool &&) = delete;
+
+    // Returns an empty handle if every object is in use.
+    Handle acquire()
+    {
+        const auto index = free_indices.pop();
+        return index ? Handle{*this, *index} : Handle{};
+    }
+
+    ~ObjectPool()
+    {
+        for (std::size_t index = 0; index < Count; index++)
+            object_at(index).~T();
+    }
+};
+
+// A per-thread stack of free indices in front of an ObjectPool. Acquiring and releasing through the cache only touches the
+// shared ring when the stack runs empty or full, and then moves half of the stack at once. Indices held by a cache are not
+// available to other threads until it is flushed, destroying the cache flushes it.
+template <typename Pool, std::size_t CacheSize = 32>
+class ObjectPoolCache
+{
+    static_assert(CacheSize >= 2, "CacheSize should be at least two.");
+
+    Pool &pool;
+    std::array<std::size_t, CacheSize> cached_indices;
+    std::size_t cached_count{0};
+
+    void refill()
+    {
+        ConsumerHandle<typename Pool::FreeIndexRing> consumer(pool.free_indices, CacheSize / 2);
+        while (cached_count < CacheSize / 2)
+        {
+            const auto index = consumer.pop();
+            if (!index)
+                break;
+            cached_indices[cached_count++] = *index;
+        }
+    }
+
+    void spill(const std::size_t count)
+    {
+        ProducerHandle<typename Pool::FreeIndexRing> producer(pool.free_indices, count);
+        for (std::size_t i = 0; i < count; i++)
+            producer.push(cached_indices[--cached_count]);
+    }
+
+public:
+    explicit ObjectPoolCache(Pool &i_pool) : pool(i_pool)
+    {
+    }
+
+    ObjectPoolCache(const ObjectPoolCache &) = delete;
+    ObjectPoolCache &operator=(const ObjectPoolCache &) = delete;
+
+    typename Pool::Handle acquire()
+    {
+        if (!cached_count)
+            refill();
+        if (!cached_count)
+            return typename Pool::Handle{};
+        return typename Pool::Handle{pool, cached_indices[--cached_count]};
+    }
+
+    // Keeps the object of a handle from the same pool in this cache instead of returning it to the shared ring.
+    void release(typename Pool::Handle &&handle)
+    {
+        if (handle.pool != &pool)
+        {
+            handle.reset();
+            return;
+        }
+
+        if (cached_count == CacheSize)
+            spill(CacheSize / 2);
+        cached_indices[cached_count++] = handle.index;
+        handle.pool = nullptr;
+    }
+
+    void flush()
+    {
+        spill(cached_count);
+    }
+
+    ~ObjectPoolCache()
+    {
+        flush();
+    }
+};
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
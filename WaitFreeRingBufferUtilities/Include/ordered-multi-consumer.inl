@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/optional-type.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/policy-configuration.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
+
+#include <cstdint>
+#include <utility>
+#include <cstddef>
+#include <atomic>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+// Strict FIFO counterpart of BasicMultiConsumer, to be used with BasicOrderedMultiProducer. Tickets are only taken for slots that
+// hold the element of that ticket's round, so elements are popped in the order they were pushed. Lock-free rather than wait-free.
+template <typename ElementType, std::size_t Count, typename Configuration>
+class BasicOrderedMultiConsumer : public Private::UsesSequencedElements
+{
+    static_assert(Count >= 2, "With a single slot the full sequence of one round is the free sequence of the next, Count should be at least 2.");
+
+    Details::CacheAlignedAndPaddedObject<std::atomic_size_t> begin{std::size_t(0)};
+
+    // The push of this ticket threw, so the slot holds nothing and is handed over to the next round as is.
+    template <typename Ring, typename Element>
+    static void release_skipped_slot(Ring &ring, Element &element, const std::size_t full_sequence)
+    {
+        element.state.store(Private::ElementState::READY_FOR_PUSH, std::memory_order_relaxed);
+        element.sequence.store(full_sequence - 1 + Count, std::memory_order_release);
+        ring.notify_pop(ring);
+    }
+
+public:
+    enum : bool
+    {
+        TOLERATES_SKIPPED_TICKETS = false, // Every ticket is popped in order, a push that threw leaves its slot SKIPPED instead.
+    };
+
+    template <typename Ring>
+    void notify_push(const Ring &) const
+    {
+    }
+
+    template <typename Ring>
+    OptionalType<ElementType> pop_impl(Ring &ring)
+    {
+        typename Configuration::WaitStrategy wait_strategy;
+        std::size_t ticket = begin.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            auto &element = ring.elements[ticket & Ring::COUNT_MASK];
+            const std::size_t full_sequence = ticket - (ticket & Ring::COUNT_MASK) + 1;
+            const std::size_t sequence = element.sequence.load(std::memory_order_acquire);
+
+            if (sequence == full_sequence)
+            {
+                if (begin.compare_exchange_weak(ticket, ticket + 1, std::memory_order_relaxed))
+                {
+                    if (element.state.load(std::memory_order_relaxed) == Private::ElementState::SKIPPED)
+                    {
+                        release_skipped_slot(ring, element, full_sequence);
+                        ticket++;
+                        continue;
+                    }
+
+                    Private::prefetch_element_for_pop<Configuration>(ring, ticket);
+                    OptionalType<ElementType> result{std::move(*element.value_ptr)};
+                    element.value_ptr->~ElementType();
+
+                    element.state.store(Private::ElementState::READY_FOR_PUSH, std::memory_order_relaxed);
+                    element.sequence.store(full_sequence - 1 + Count, std::memory_order_release);
+                    ring.notify_pop(ring);
+                    return result;
+                }
+            }
+            else if (static_cast<std::ptrdiff_t>(sequence - full_sequence) < 0)
+                return OptionalType<ElementType>{}; // The element of this round has not been pushed yet.
+            else
+                ticket = begin.load(std::memory_order_relaxed);
+
+            wait_strategy.wait();
+        }
+    }
+
+    // The same protocol for a caller that knows no other thread is popping, so the ticket needs no compare and swap.
+    template <typename Ring>
+    OptionalType<ElementType> pop_exclusive_impl(Ring &ring)
+    {
+        std::size_t ticket = begin.load(std::memory_order_relaxed);
+        auto *element = &ring.elements[ticket & Ring::COUNT_MASK];
+        std::size_t full_sequence = ticket - (ticket & Ring::COUNT_MASK) + 1;
+
+        while (element->sequence.load(std::memory_order_acquire) == full_sequence &&
+               element->state.load(std::memory_order_relaxed) == Private::ElementState::SKIPPED)
+        {
+            begin.store(++ticket, std::memory_order_relaxed);
+            release_skipped_slot(ring, *element, full_sequence);
+            element = &ring.elements[ticket & Ring::COUNT_MASK];
+            full_sequence = ticket - (ticket & Ring::COUNT_MASK) + 1;
+        }
+
+        if (element->sequence.load(std::memory_order_acquire) != full_sequence)
+            return OptionalType<ElementType>{};
+
+        Private::prefetch_element_for_pop<Configuration>(ring, ticket);
+        OptionalType<ElementType> result{std::move(*element->value_ptr)};
+        element->value_ptr->~ElementType();
+
+        element->state.store(Private::ElementState::READY_FOR_PUSH, std::memory_order_relaxed);
+        element->sequence.store(full_sequence - 1 + Count, std::memory_order_release);
+        begin.store(ticket + 1, std::memory_order_relaxed);
+        ring.notify_pop(ring);
+        return result;
+    }
+};
+
+template <typename ElementType, std::size_t Count>
+using OrderedMultiConsumer = BasicOrderedMultiConsumer<ElementType, Count, DefaultPolicyConfiguration>;
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/policy-configuration.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
+
+#include <cstdint>
+#include <utility>
+#include <cstddef>
+#include <atomic>
+#include <type_traits>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+// Strict FIFO counterpart of BasicMultiProducer, to be used with BasicOrderedMultiConsumer. A ticket is only taken once its slot
+// is known to be free for that ticket's round, so elements are popped exactly in the order their tickets were taken. Losing the
+// ticket to another producer means retrying, which makes push lock-free rather than wait-free.
+template <typename ElementType, std::size_t Count, typename Configuration>
+class BasicOrderedMultiProducer : public Private::UsesSequencedElements
+{
+    static_assert(Count >= 2, "With a single slot the full sequence of one round is the free sequence of the next, Count should be at least 2.");
+
+    Details::CacheAlignedAndPaddedObject<std::atomic_size_t> end{std::size_t(0)};
+
+    template <typename Element, typename... Args>
+    static void fill_slot(std::true_type, Element &element, const std::size_t free_sequence, Args &&...args)
+    {
+        element.value_ptr = Private::construct_element<Configuration, ElementType>(element.storage, std::forward<Args>(args)...);
+
+        element.state.store(Private::ElementState::READY_FOR_POP, std::memory_order_relaxed);
+        element.sequence.store(free_sequence + 1, std::memory_order_release);
+    }
+
+    // The ticket is taken by then and consumers pop tickets in order, so the slot is still published for its round, marked as
+    // SKIPPED for the consumers to step over.
+    template <typename Element, typename... Args>
+    static void fill_slot(std::false_type, Element &element, const std::size_t free_sequence, Args &&...args)
+    {
+        try
+        {
+            fill_slot(std::true_type{}, element, free_sequence, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            element.state.store(Private::ElementState::SKIPPED, std::memory_order_relaxed);
+            element.sequence.store(free_sequence + 1, std::memory_order_release);
+            throw;
+        }
+    }
+
+public:
+    template <typename Ring>
+    void notify_pop(const Ring &) const
+    {
+    }
+
+    template <typename Ring, typename... Args>
+    bool push_impl(Ring &ring, Args &&...args)
+    {
+        typename Configuration::WaitStrategy wait_strategy;
+        std::size_t ticket = end.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            auto &element = ring.elements[ticket & Ring::COUNT_MASK];
+            const std::size_t free_sequence = ticket - (ticket & Ring::COUNT_MASK);
+            const std::size_t sequence = element.sequence.load(std::memory_order_acquire);
+
+            if (sequence == free_sequence)
+            {
+                if (end.compare_exchange_weak(ticket, ticket + 1, std::memory_order_relaxed))
+                {
+                    Private::prefetch_element_for_push<Configuration>(ring, ticket);
+                    fill_slot(Private::IsNothrowConstruction<Configuration, ElementType, Args...>{}, element, free_sequence, std::forward<Args>(args)...);
+                    ring.notify_push(ring);
+                    return true;
+                }
+            }
+            else if (static_cast<std::ptrdiff_t>(sequence - free_sequence) < 0)
+                return false; // The slot still holds the element of the previous round.
+            else
+                ticket = end.load(std::memory_order_relaxed);
+
+            wait_strategy.wait();
+        }
+    }
+
+    // The same protocol for a caller that knows no other thread is pushing, so the ticket needs no compare and swap.
+    template <typename Ring, typename... Args>
+    bool push_exclusive_impl(Ring &ring, Args &&...args)
+    {
+        const std::size_t ticket = end.load(std::memory_order_relaxed);
+        auto &element = ring.elements[ticket & Ring::COUNT_MASK];
+        const std::size_t free_sequence = ticket - (ticket & Ring::COUNT_MASK);
+
+        if (element.sequence.load(std::memory_order_acquire) != free_sequence)
+            return false;
+
+        Private::prefetch_element_for_push<Configuration>(ring, ticket);
+        end.store(ticket + 1, std::memory_order_relaxed);
+        fill_slot(Private::IsNothrowConstruction<Configuration, ElementType, Args...>{}, element, free_sequence, std::forward<Args>(args)...);
+        ring.notify_push(ring);
+        return true;
+    }
+};
+
+template <typename ElementType, std::size_t Count>
+using OrderedMultiProducer = BasicOrderedMultiProducer<ElementType, Count, DefaultPolicyConfiguration>;
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
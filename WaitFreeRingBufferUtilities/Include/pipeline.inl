@@ -0,0 +1,433 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/multi-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/multi-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/single-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/single-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/aligned-allocation.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/thread-affinity.inl"
+
+#include <cstdint>
+#include <utility>
+#include <cstddef>
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+namespace Private
+{
+template <std::size_t ThreadCount>
+struct ProducerPolicySelector
+{
+    static_assert(ThreadCount > 0, "At least one producer thread is required.");
+
+    template <typename ElementType, std::size_t Count>
+    using Policy = MultiProducer<ElementType, Count>;
+};
+
+template <>
+struct ProducerPolicySelector<1>
+{
+    template <typename ElementType, std::size_t Count>
+    using Policy = SingleProducer<ElementType, Count>;
+};
+
+template <std::size_t ThreadCount>
+struct ConsumerPolicySelector
+{
+    static_assert(ThreadCount > 0, "At least one consumer thread is required.");
+
+    template <typename ElementType, std::size_t Count>
+    using Policy = MultiConsumer<ElementType, Count>;
+};
+
+template <>
+struct ConsumerPolicySelector<1>
+{
+    template <typename ElementType, std::size_t Count>
+    using Policy = SingleConsumer<ElementType, Count>;
+};
+} // namespace Private
+
+template <typename ElementType, std::size_t Count, std::size_t ProducerCount, std::size_t ConsumerCount>
+using AutoPolicyRingBuffer = RingBuffer<Private::ProducerPolicySelector<ProducerCount>::template Policy,
+                                        Private::ConsumerPolicySelector<ConsumerCount>::template Policy,
+                                        ElementType,
+                                        Count>;
+
+struct StageOptions
+{
+    std::vector<std::size_t> cpus; // Worker i is pinned to cpus[i % cpus.size()], no pinning if empty.
+    std::size_t batch_size{64};
+};
+
+struct StageStatistics
+{
+    std::string name;
+    std::uint64_t processed_count;
+    double throughput; // Elements per second since the pipeline was started.
+    double average_queueing_delay_ns;
+    std::uint64_t max_queueing_delay_ns;
+};
+
+namespace Private
+{
+using PipelineClock = std::chrono::steady_clock;
+
+template <typename T>
+struct PipelineMessage
+{
+    PipelineClock::time_point enqueue_time;
+    T value;
+
+    template <typename... Args>
+    explicit PipelineMessage(Args &&...args) : enqueue_time(PipelineClock::now()),
+                                               value(std::forward<Args>(args)...)
+    {
+    }
+};
+
+template <typename InputType>
+class StageInput
+{
+public:
+    virtual ~StageInput() = default;
+
+    // The value is only moved from if the push succeeds.
+    virtual bool try_push(InputType &&value) = 0;
+    virtual void upstream_finished() = 0;
+};
+
+class StageBase
+{
+public:
+    virtual ~StageBase() = default;
+
+    virtual void start(PipelineClock::time_point start_time) = 0;
+    virtual void join() = 0;
+    virtual StageStatistics statistics(PipelineClock::time_point now) const = 0;
+};
+
+template <typename InputType>
+inline void push_with_backpressure(StageInput<InputType> &input, InputType &&value)
+{
+    while (!input.try_push(std::move(value)))
+        std::this_thread::yield();
+}
+
+template <typename InputType, typename OutputType, typename Function>
+class TransformProcessor
+{
+    Function function;
+
+public:
+    StageInput<OutputType> *next{nullptr};
+
+    explicit TransformProcessor(Function &&i_function) : function(std::move(i_function)) {}
+
+    void process(InputType &&value)
+    {
+        OutputType result = function(std::move(value));
+        push_with_backpressure(*next, std::move(result));
+    }
+
+    void finish()
+    {
+        next->upstream_finished();
+    }
+};
+
+template <typename InputType, typename Function>
+class SinkProcessor
+{
+    Function function;
+
+public:
+    explicit SinkProcessor(Function &&i_function) : function(std::move(i_function)) {}
+
+    void process(InputType &&value)
+    {
+        function(std::move(value));
+    }
+
+    void finish()
+    {
+    }
+};
+
+template <typename InputType, std::size_t Count, std::size_t UpstreamCount, std::size_t WorkerCount, typename Processor>
+class Stage final : public StageBase, public StageInput<InputType>
+{
+    using RingType = AutoPolicyRingBuffer<PipelineMessage<InputType>, Count, UpstreamCount, WorkerCount>;
+
+    struct WorkerStatistics
+    {
+        std::atomic<std::uint64_t> processed_count{0};
+        std::atomic<std::uint64_t> total_queueing_delay_ns{0};
+        std::atomic<std::uint64_t> max_queueing_delay_ns{0};
+    };
+
+    using WorkerStatisticsArray = std::array<Details::CacheAlignedAndPaddedObject<WorkerStatistics>, WorkerCount>;
+
+    const std::string name;
+    const StageOptions options;
+    Details::AlignedUniquePtr<RingType> ring{Details::make_aligned_unique<RingType>()};
+    Details::AlignedUniquePtr<WorkerStatisticsArray> worker_statistics{Details::make_aligned_unique<WorkerStatisticsArray>()};
+    std::atomic<bool> is_upstream_finished{false};
+    std::atomic<std::size_t> running_worker_count{WorkerCount};
+    std::vector<std::thread> workers;
+    PipelineClock::time_point start_time;
+
+    void work(const std::size_t worker_index)
+    {
+        if (!options.cpus.empty())
+            Details::pin_current_thread_to_cpu(options.cpus[worker_index % options.cpus.size()]);
+
+        auto &statistics = (*worker_statistics)[worker_index];
+        std::uint64_t processed_count = 0;
+        std::uint64_t total_queueing_delay_ns = 0;
+        std::uint64_t max_queueing_delay_ns = 0;
+
+        while (true)
+        {
+            const bool was_upstream_finished = is_upstream_finished.load(std::memory_order_acquire);
+
+            std::size_t batch_count = 0;
+            for (; batch_count < options.batch_size; batch_count++)
+            {
+                auto message = ring->pop();
+                if (!message)
+                    break;
+
+                const std::uint64_t queueing_delay_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                            PipelineClock::now() - message->enqueue_time)
+                                                            .count();
+                total_queueing_delay_ns += queueing_delay_ns;
+                max_queueing_delay_ns = queueing_delay_ns > max_queueing_delay_ns ? queueing_delay_ns : max_queueing_delay_ns;
+
+                processor.process(std::move(message->value));
+            }
+
+            if (batch_count)
+            {
+                processed_count += batch_count;
+                statistics.processed_count.store(processed_count, std::memory_order_relaxed);
+                statistics.total_queueing_delay_ns.store(total_queueing_delay_ns, std::memory_order_relaxed);
+                statistics.max_queueing_delay_ns.store(max_queueing_delay_ns, std::memory_order_relaxed);
+            }
+            else if (was_upstream_finished)
+                break;
+            else
+                std::this_thread::yield();
+        }
+
+        if (running_worker_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            processor.finish();
+    }
+
+public:
+    Processor processor;
+
+    Stage(std::string i_name, StageOptions i_options, Processor &&i_processor)
+        : name(std::move(i_name)),
+          options(std::move(i_options)),
+          processor(std::move(i_processor))
+    {
+    }
+
+    bool try_push(InputType &&value) override
+    {
+        return ring->push(std::move(value));
+    }
+
+    void upstream_finished() override
+    {
+        is_upstream_finished.store(true, std::memory_order_release);
+    }
+
+    void start(const PipelineClock::time_point i_start_time) override
+    {
+        start_time = i_start_time;
+        for (std::size_t worker_index = 0; worker_index < WorkerCount; worker_index++)
+            workers.emplace_back([this, worker_index]() { work(worker_index); });
+    }
+
+    void join() override
+    {
+        for (auto &worker : workers)
+            if (worker.joinable())
+                worker.join();
+    }
+
+    StageStatistics statistics(const PipelineClock::time_point now) const override
+    {
+        StageStatistics result{name, 0, 0.0, 0.0, 0};
+        std::uint64_t total_queueing_delay_ns = 0;
+        for (const auto &worker : *worker_statistics)
+        {
+            result.processed_count += worker.processed_count.load(std::memory_order_relaxed);
+            total_queueing_delay_ns += worker.total_queueing_delay_ns.load(std::memory_order_relaxed);
+            const std::uint64_t max_queueing_delay_ns = worker.max_queueing_delay_ns.load(std::memory_order_relaxed);
+            result.max_queueing_delay_ns = max_queueing_delay_ns > result.max_queueing_delay_ns ? max_queueing_delay_ns : result.max_queueing_delay_ns;
+        }
+
+        const double elapsed_seconds = std::chrono::duration<double>(now - start_time).count();
+        if (elapsed_seconds > 0.0)
+            result.throughput = result.processed_count / elapsed_seconds;
+        if (result.processed_count)
+            result.average_queueing_delay_ns = double(total_queueing_delay_ns) / result.processed_count;
+
+        return result;
+    }
+};
+
+template <typename SourceType>
+struct PipelineEntry
+{
+    StageInput<SourceType> *input{nullptr};
+};
+} // namespace Private
+
+template <typename SourceType, std::size_t SourceProducerCount>
+class Pipeline
+{
+    std::unique_ptr<Private::PipelineEntry<SourceType>> entry;
+    std::vector<std::unique_ptr<Private::StageBase>> stages;
+    Private::PipelineClock::time_point start_time;
+    bool is_started{false};
+    bool is_closed{false};
+
+public:
+    Pipeline(std::unique_ptr<Private::PipelineEntry<SourceType>> i_entry,
+             std::vector<std::unique_ptr<Private::StageBase>> i_stages)
+        : entry(std::move(i_entry)),
+          stages(std::move(i_stages))
+    {
+    }
+
+    Pipeline(Pipeline &&) = default;
+    Pipeline &operator=(Pipeline &&) = delete;
+
+    void start()
+    {
+        start_time = Private::PipelineClock::now();
+        for (auto &stage : stages)
+            stage->start(start_time);
+        is_started = true;
+    }
+
+    // Must not be called from more than SourceProducerCount threads at a time.
+    bool try_push(SourceType &&value)
+    {
+        return entry->input->try_push(std::move(value));
+    }
+
+    void push(SourceType value)
+    {
+        Private::push_with_backpressure(*entry->input, std::move(value));
+    }
+
+    // Stops accepting input; every stage drains its ring before its workers exit.
+    void close()
+    {
+        if (!is_closed)
+            entry->input->upstream_finished();
+        is_closed = true;
+    }
+
+    void join()
+    {
+        for (auto &stage : stages)
+            stage->join();
+    }
+
+    std::vector<StageStatistics> statistics() const
+    {
+        const auto now = Private::PipelineClock::now();
+        std::vector<StageStatistics> result;
+        for (const auto &stage : stages)
+            result.push_back(stage->statistics(now));
+        return result;
+    }
+
+    ~Pipeline()
+    {
+        if (!entry)
+            return;
+
+        if (!is_started)
+            start();
+        close();
+        join();
+    }
+};
+
+template <typename SourceType, std::size_t SourceProducerCount, typename TailType, std::size_t TailThreadCount>
+class PipelineBuilder
+{
+    std::unique_ptr<Private::PipelineEntry<SourceType>> entry;
+    std::vector<std::unique_ptr<Private::StageBase>> stages;
+    Private::StageInput<TailType> **tail_output;
+
+public:
+    PipelineBuilder(std::unique_ptr<Private::PipelineEntry<SourceType>> i_entry,
+                    std::vector<std::unique_ptr<Private::StageBase>> i_stages,
+                    Private::StageInput<TailType> **i_tail_output)
+        : entry(std::move(i_entry)),
+          stages(std::move(i_stages)),
+          tail_output(i_tail_output)
+    {
+    }
+
+    template <typename OutputType, std::size_t Count, std::size_t WorkerCount = 1, typename Function>
+    PipelineBuilder<SourceType, SourceProducerCount, OutputType, WorkerCount> stage(std::string name,
+                                                                                     Function function,
+                                                                                     StageOptions options = StageOptions{}) &&
+    {
+        using ProcessorType = Private::TransformProcessor<TailType, OutputType, Function>;
+        using StageType = Private::Stage<TailType, Count, TailThreadCount, WorkerCount, ProcessorType>;
+
+        std::unique_ptr<StageType> new_stage{new StageType(std::move(name), std::move(options), ProcessorType(std::move(function)))};
+        *tail_output = new_stage.get();
+        Private::StageInput<OutputType> **next_tail_output = &new_stage->processor.next;
+        stages.push_back(std::move(new_stage));
+
+        return PipelineBuilder<SourceType, SourceProducerCount, OutputType, WorkerCount>(std::move(entry), std::move(stages), next_tail_output);
+    }
+
+    template <std::size_t Count, std::size_t WorkerCount = 1, typename Function>
+    Pipeline<SourceType, SourceProducerCount> sink(std::string name,
+                                                   Function function,
+                                                   StageOptions options = StageOptions{}) &&
+    {
+        using ProcessorType = Private::SinkProcessor<TailType, Function>;
+        using StageType = Private::Stage<TailType, Count, TailThreadCount, WorkerCount, ProcessorType>;
+
+        std::unique_ptr<StageType> new_stage{new StageType(std::move(name), std::move(options), ProcessorType(std::move(function)))};
+        *tail_output = new_stage.get();
+        stages.push_back(std::move(new_stage));
+
+        return Pipeline<SourceType, SourceProducerCount>(std::move(entry), std::move(stages));
+    }
+};
+
+template <typename SourceType, std::size_t SourceProducerCount = 1>
+PipelineBuilder<SourceType, SourceProducerCount, SourceType, SourceProducerCount> make_pipeline()
+{
+    std::unique_ptr<Private::PipelineEntry<SourceType>> entry{new Private::PipelineEntry<SourceType>};
+    Private::StageInput<SourceType> **tail_output = &entry->input;
+    return PipelineBuilder<SourceType, SourceProducerCount, SourceType, SourceProducerCount>(std::move(entry), {}, tail_output);
+}
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/wait-strategy.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/memory-access.inl"
+
+#include <utility>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+template <typename WaitStrategyType = BusySpinWait, std::size_t PrefetchDistance = 0, std::size_t StreamingStoreThreshold = 0>
+struct PolicyConfiguration
+{
+    using WaitStrategy = WaitStrategyType; // Used when a ticket is lost to another thread.
+
+    enum : std::size_t
+    {
+        PREFETCH_DISTANCE = PrefetchDistance,                // Slots ahead of each cursor to prefetch, 0 disables prefetching.
+        STREAMING_STORE_THRESHOLD = StreamingStoreThreshold, // Trivially copyable elements at least this large are pushed with
+                                                             // non-temporal stores, 0 disables streaming stores.
+    };
+};
+
+using DefaultPolicyConfiguration = PolicyConfiguration<>;
+
+namespace Private
+{
+template <typename Configuration, typename ElementType, typename... Args>
+struct UsesStreamingStore : std::false_type
+{
+};
+
+template <typename Configuration, typename ElementType, typename Arg>
+struct UsesStreamingStore<Configuration, ElementType, Arg>
+    : std::integral_constant<bool, Configuration::STREAMING_STORE_THRESHOLD != 0 &&
+                                       sizeof(ElementType) >= Configuration::STREAMING_STORE_THRESHOLD &&
+                                       std::is_trivially_copyable<ElementType>::value &&
+                                       std::is_same<typename std::decay<Arg>::type, ElementType>::value>
+{
+};
+
+template <typename ElementType, typename Storage, typename... Args>
+ElementType *construct_element(std::false_type, Storage &storage, Args &&...args)
+{
+    return new (&storage) ElementType(std::forward<Args>(args)...);
+}
+
+template <typename ElementType, typename Storage, typename Arg>
+ElementType *construct_element(std::true_type, Storage &storage, Arg &&value)
+{
+    Details::streaming_copy(&storage, &value, sizeof(ElementType));
+    return reinterpret_cast<ElementType *>(&storage);
+}
+
+// Whether building an element from these arguments can throw, so producers only pay for rolling a slot back when it can.
+template <typename Configuration, typename ElementType, typename... Args>
+struct IsNothrowConstruction : std::integral_constant<bool, UsesStreamingStore<Configuration, ElementType, Args...>::value ||
+                                                               std::is_nothrow_constructible<ElementType, Args &&...>::value>
+{
+};
+
+template <typename Configuration, typename ElementType, typename Storage, typename... Args>
+ElementType *construct_element(Storage &storage, Args &&...args)
+{
+    return construct_element<ElementType>(UsesStreamingStore<Configuration, ElementType, Args...>{}, storage, std::forward<Args>(args)...);
+}
+
+template <typename Configuration, typename Ring>
+void prefetch_element_for_push(const Ring &ring, const std::size_t position)
+{
+    if (Configuration::PREFETCH_DISTANCE != 0)
+        Details::prefetch_for_write(&ring.elements[(position + Configuration::PREFETCH_DISTANCE) & Ring::COUNT_MASK], sizeof(ring.elements[0]));
+}
+
+template <typename Configuration, typename Ring>
+void prefetch_element_for_pop(const Ring &ring, const std::size_t position)
+{
+    if (Configuration::PREFETCH_DISTANCE != 0)
+        Details::prefetch_for_read(&ring.elements[(position + Configuration::PREFETCH_DISTANCE) & Ring::COUNT_MASK], sizeof(ring.elements[0]));
+}
+} // namespace Private
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
@@ -8,6 +8,10 @@
 #include <cstddef>
 #include <atomic>
 #include <array>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
 
 namespace Iyp
 {
@@ -22,6 +26,7 @@ enum : std::uint_fast8_t // Use enum instead of inline constexpr variable to sup
     IN_PROGRESS, // Optional
     READY_FOR_PUSH,
     READY_FOR_POP,
+    SKIPPED, // Left empty by a push that threw, for a consumer that reads slots in order to free.
 };
 } // namespace ElementState
 
@@ -48,6 +53,27 @@ struct Element
     }
 };
 
+// Policies that derive from this hand slots over through a per-slot sequence number instead of the element state alone.
+struct UsesSequencedElements
+{
+};
+
+template <typename T>
+struct SequencedElement : Element<T>
+{
+    // Stored relative to the slot index, so that zero initialization marks every slot as free for the first round.
+    std::atomic_size_t sequence{0};
+};
+
+template <typename Producer, typename Consumer, typename ElementType>
+struct ElementSelector
+{
+    static_assert(std::is_base_of<UsesSequencedElements, Producer>::value == std::is_base_of<UsesSequencedElements, Consumer>::value,
+                  "Ordered policies should only be combined with each other.");
+
+    using type = typename std::conditional<std::is_base_of<UsesSequencedElements, Producer>::value, SequencedElement<ElementType>, Element<ElementType>>::type;
+};
+
 template <template <typename, std::size_t> class Producer,
           template <typename, std::size_t> class Consumer,
           typename ElementType, std::size_t Count>
@@ -59,7 +85,9 @@ struct RingBufferTypeConstructor : Producer<ElementType, Count>, Consumer<Elemen
     };
     static_assert(Count && !(COUNT_MASK & Count), "Count should be a power of two.");
 
-    std::array<Details::CacheAlignedAndPaddedObject<Element<ElementType>>, Count> elements{};
+    using ElementSlot = typename ElementSelector<Producer<ElementType, Count>, Consumer<ElementType, Count>, ElementType>::type;
+
+    std::array<Details::CacheAlignedAndPaddedObject<ElementSlot>, Count> elements{};
 
     template <typename... Args>
     bool push(Args &&...args)
@@ -71,9 +99,119 @@ struct RingBufferTypeConstructor : Producer<ElementType, Count>, Consumer<Elemen
     {
         return this->pop_impl(*this);
     }
+
+    ElementType *front()
+    {
+        return this->front_impl(*this);
+    }
+
+    void attach_producer()
+    {
+        this->attach_producer_impl();
+    }
+
+    void detach_producer()
+    {
+        this->detach_producer_impl();
+    }
+
+    void attach_consumer()
+    {
+        this->attach_consumer_impl();
+    }
+
+    void detach_consumer()
+    {
+        this->detach_consumer_impl();
+    }
+
+    // Copies the elements that are ready for pop without touching any slot state or counter, in the order of their push tickets,
+    // which the slot sequences encode. Each copy is validated like a seqlock read: a copy is kept only if the slot sequence did not
+    // move while it was taken, so an element that is popped and pushed again meanwhile is skipped rather than torn. Under concurrent
+    // traffic the result is best-effort, elements can be missed. Only rings of the ordered and adaptive policies can be inspected,
+    // the plain policies do not number their slots and the state of a plain slot cannot tell such a refill apart.
+    std::vector<ElementType> snapshot() const
+    {
+        static_assert(std::is_trivially_copyable<ElementType>::value, "Snapshots copy elements that may be popped concurrently.");
+        static_assert(std::is_same<ElementSlot, SequencedElement<ElementType>>::value,
+                      "Snapshots need the slot sequences of the ordered or adaptive policies to validate their copies.");
+
+        std::vector<std::pair<std::size_t, ElementType>> ticketed_copies;
+        for (std::size_t i = 0; i < Count; i++)
+        {
+            const ElementSlot &element = elements[i];
+            const std::size_t sequence = element.sequence.load(std::memory_order_acquire);
+            if (element.state.load(std::memory_order_acquire) != ElementState::READY_FOR_POP)
+                continue;
+
+            typename std::aligned_storage<sizeof(ElementType), alignof(ElementType)>::type copy;
+            std::memcpy(&copy, &element.storage, sizeof(ElementType));
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (element.state.load(std::memory_order_relaxed) == ElementState::READY_FOR_POP &&
+                element.sequence.load(std::memory_order_relaxed) == sequence)
+                ticketed_copies.emplace_back(sequence - 1 + i, *reinterpret_cast<const ElementType *>(&copy)); // Sequences are relative to the slot index.
+        }
+
+        std::sort(ticketed_copies.begin(), ticketed_copies.end(),
+                  [](const std::pair<std::size_t, ElementType> &a, const std::pair<std::size_t, ElementType> &b) { return a.first < b.first; });
+
+        std::vector<ElementType> copies;
+        copies.reserve(ticketed_copies.size());
+        for (const auto &ticketed_copy : ticketed_copies)
+            copies.push_back(ticketed_copy.second);
+        return copies;
+    }
+
+    std::size_t reserve_push_credits(const std::size_t count)
+    {
+        return this->reserve_push_credits_impl(count);
+    }
+
+    std::size_t reserve_push_tickets(const std::size_t count)
+    {
+        return this->reserve_push_tickets_impl(count);
+    }
+
+    template <typename... Args>
+    void push_reserved(const std::size_t ticket, Args &&...args)
+    {
+        this->push_reserved_impl(*this, ticket, std::forward<Args>(args)...);
+    }
+
+    void release_push_credits(const std::size_t count)
+    {
+        this->release_push_credits_impl(count);
+    }
+
+    std::size_t reserve_pop_credits(const std::size_t count)
+    {
+        return this->reserve_pop_credits_impl(count);
+    }
+
+    std::size_t reserve_pop_tickets(const std::size_t count)
+    {
+        return this->reserve_pop_tickets_impl(count);
+    }
+
+    OptionalType<ElementType> pop_reserved(const std::size_t ticket)
+    {
+        return this->pop_reserved_impl(*this, ticket);
+    }
+
+    void release_pop_credits(const std::size_t count)
+    {
+        this->release_pop_credits_impl(count);
+    }
 };
 } // namespace Private
 
+template <typename Ring>
+class ProducerHandle;
+
+template <typename Ring>
+class ConsumerHandle;
+
 template <template <typename, std::size_t> class Producer,
           template <typename, std::size_t> class Consumer,
           typename ElementType, std::size_t Count>
@@ -81,9 +219,21 @@ class RingBuffer : Private::RingBufferTypeConstructor<Producer, Consumer, Elemen
 {
     using Parrent = Private::RingBufferTypeConstructor<Producer, Consumer, ElementType, Count>;
 
+    template <typename Ring>
+    friend class ProducerHandle;
+
+    template <typename Ring>
+    friend class ConsumerHandle;
+
 public:
     using Parrent::push;
     using Parrent::pop;
+    using Parrent::front;
+    using Parrent::snapshot;
+    using Parrent::attach_producer;
+    using Parrent::detach_producer;
+    using Parrent::attach_consumer;
+    using Parrent::detach_consumer;
 };
 
 } // namespace WaitFreeRingBufferUtilities
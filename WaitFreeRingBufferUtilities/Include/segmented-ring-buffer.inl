@@ -0,0 +1,190 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/multi-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/multi-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/optional-type.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/aligned-allocation.inl"
+
+#include <cstdint>
+#include <utility>
+#include <cstddef>
+#include <atomic>
+#include <array>
+#include <new>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+namespace Private
+{
+template <typename ElementType, std::size_t SegmentSize>
+struct Segment
+{
+    std::array<Details::CacheAlignedAndPaddedObject<Element<ElementType>>, SegmentSize> elements{};
+};
+} // namespace Private
+
+// Multi producer single consumer queue that chains fixed size segments instead of failing when one fills up. Drained
+// segments go back to a small pool or are freed, so memory tracks the backlog. push() only fails once the backlog spans
+// MaxSegmentCount - 1 segments, and never waits for the consumer. Tickets are taken with a CAS, which makes push() lock-free
+// rather than wait-free.
+template <typename ElementType, std::size_t SegmentSize = 1024, std::size_t MaxSegmentCount = 1024, std::size_t SegmentPoolSize = 4>
+class SegmentedRingBuffer
+{
+    enum : std::size_t
+    {
+        SEGMENT_MASK = SegmentSize - 1,
+        DIRECTORY_MASK = MaxSegmentCount - 1,
+    };
+    static_assert(SegmentSize && !(SEGMENT_MASK & SegmentSize), "SegmentSize should be a power of two.");
+    static_assert(MaxSegmentCount > 1 && !(DIRECTORY_MASK & MaxSegmentCount), "MaxSegmentCount should be a power of two greater than one.");
+
+    using Segment = Private::Segment<ElementType, SegmentSize>;
+
+    // Segment s lives in directory slot s % MaxSegmentCount. The slot serves the segment named by segment_id, and segment is
+    // null until one is installed for it. A segment is not retired before all of its tickets are consumed, so no producer can
+    // still be holding a pointer to it, or be about to install one in its slot, by then.
+    struct DirectorySlot
+    {
+        std::atomic_size_t segment_id;
+        std::atomic<Segment *> segment{nullptr};
+    };
+
+    struct ConsumerState
+    {
+        std::size_t begin{0};
+        Segment *segment{nullptr};
+    };
+
+    Details::CacheAlignedAndPaddedObject<std::atomic_size_t> end{std::size_t(0)};
+    Details::CacheAlignedAndPaddedObject<std::atomic_size_t> retired_segment_count{std::size_t(0)};
+    Details::CacheAlignedAndPaddedObject<ConsumerState> consumer_state;
+    std::array<DirectorySlot, MaxSegmentCount> directory;
+    RingBuffer<MultiProducer, MultiConsumer, Segment *, SegmentPoolSize> segment_pool;
+
+    Segment *take_segment()
+    {
+        auto pooled_segment = segment_pool.pop();
+        if (pooled_segment)
+            return *pooled_segment;
+        return Details::make_aligned_unique<Segment>().release();
+    }
+
+    static void delete_segment(Segment *const segment)
+    {
+        Details::AlignedDeleter<Segment>{}(segment);
+    }
+
+    void give_back_segment(Segment *const segment)
+    {
+        if (!segment_pool.push(segment))
+            delete_segment(segment);
+    }
+
+    Segment &acquire_segment(const std::size_t segment_id)
+    {
+        auto &slot = directory[segment_id & DIRECTORY_MASK];
+
+        // push() only takes a ticket after seeing the older segment of this slot retired, so the slot already serves segment_id.
+        Segment *installed_segment = slot.segment.load(std::memory_order_acquire);
+        if (installed_segment)
+            return *installed_segment;
+
+        // Every producer that finds the slot empty brings a segment, the first to install it wins and the others give theirs
+        // back, so no producer waits on another.
+        Segment *const segment = take_segment();
+        if (slot.segment.compare_exchange_strong(installed_segment, segment, std::memory_order_acq_rel, std::memory_order_acquire))
+            return *segment;
+
+        give_back_segment(segment);
+        return *installed_segment;
+    }
+
+    void retire_segment(ConsumerState &state)
+    {
+        const std::size_t segment_id = state.begin / SegmentSize - 1;
+        Segment *const segment = state.segment;
+        state.segment = nullptr;
+
+        auto &slot = directory[segment_id & DIRECTORY_MASK];
+        slot.segment.store(nullptr, std::memory_order_relaxed);
+        slot.segment_id.store(segment_id + MaxSegmentCount, std::memory_order_release);
+        retired_segment_count.store(segment_id + 1, std::memory_order_release);
+
+        give_back_segment(segment);
+    }
+
+public:
+    SegmentedRingBuffer()
+    {
+        for (std::size_t i = 0; i < MaxSegmentCount; i++)
+            directory[i].segment_id.store(i, std::memory_order_relaxed);
+    }
+
+    SegmentedRingBuffer(const SegmentedRingBuffer &) = delete;
+    SegmentedRingBuffer(SegmentedRingBuffer &&) = delete;
+
+    SegmentedRingBuffer &operator=(const SegmentedRingBuffer &) = delete;
+    SegmentedRingBuffer &operator=(SegmentedRingBuffer &&) = delete;
+
+    template <typename... Args>
+    bool push(Args &&...args)
+    {
+        // The capacity check and the ticket are one step, so a producer never holds a ticket whose directory slot is still taken.
+        std::size_t ticket = end.load(std::memory_order_relaxed);
+        do
+            if (ticket / SegmentSize - retired_segment_count.load(std::memory_order_acquire) >= MaxSegmentCount - 1)
+                return false;
+        while (!end.compare_exchange_weak(ticket, ticket + 1, std::memory_order_relaxed, std::memory_order_relaxed));
+
+        auto &element = acquire_segment(ticket / SegmentSize).elements[ticket & SEGMENT_MASK];
+
+        element.value_ptr = new (&element.storage) ElementType(std::forward<Args>(args)...);
+        element.state.store(Private::ElementState::READY_FOR_POP, std::memory_order_release);
+        return true;
+    }
+
+    OptionalType<ElementType> pop()
+    {
+        ConsumerState &state = consumer_state;
+
+        if (!state.segment)
+        {
+            const std::size_t segment_id = state.begin / SegmentSize;
+            auto &slot = directory[segment_id & DIRECTORY_MASK];
+            if (slot.segment_id.load(std::memory_order_acquire) != segment_id)
+                return OptionalType<ElementType>{};
+            state.segment = slot.segment.load(std::memory_order_acquire);
+            if (!state.segment)
+                return OptionalType<ElementType>{};
+        }
+
+        auto &element = state.segment->elements[state.begin & SEGMENT_MASK];
+        if (element.state.load(std::memory_order_acquire) != Private::ElementState::READY_FOR_POP)
+            return OptionalType<ElementType>{};
+
+        OptionalType<ElementType> result{std::move(*element.value_ptr)};
+        element.value_ptr->~ElementType();
+        element.state.store(Private::ElementState::READY_FOR_PUSH, std::memory_order_relaxed);
+
+        if (!(++state.begin & SEGMENT_MASK))
+            retire_segment(state);
+        return result;
+    }
+
+    ~SegmentedRingBuffer()
+    {
+        for (auto &slot : directory)
+            if (Segment *const segment = slot.segment.load(std::memory_order_acquire))
+                delete_segment(segment);
+
+        while (auto pooled_segment = segment_pool.pop())
+            delete_segment(*pooled_segment);
+    }
+};
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
@@ -1,10 +1,12 @@
 #pragma once
 
 #include "Iyp/WaitFreeRingBufferUtilities/optional-type.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/policy-configuration.inl"
 #include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
 
 #include <cstdint>
 #include <utility>
+#include <cstddef>
 #include <atomic>
 
 namespace Iyp
@@ -12,8 +14,8 @@ namespace Iyp
 namespace WaitFreeRingBufferUtilities
 {
 
-template <typename ElementType, std::size_t Count>
-class SingleConsumer
+template <typename ElementType, std::size_t Count, typename Configuration>
+class BasicSingleConsumer
 {
     struct State
     {
@@ -23,31 +25,67 @@ class SingleConsumer
     Details::CacheAlignedAndPaddedObject<State> state;
 
 public:
+    enum : bool
+    {
+        TOLERATES_SKIPPED_TICKETS = false, // Slots are read strictly in order, so a skipped ticket would stall the consumer.
+    };
+
     template <typename Ring>
     void notify_push(const Ring &) const
     {
     }
 
+    // The front element stays in place until the next pop, so only the consumer thread may peek at it.
     template <typename Ring>
-    OptionalType<ElementType> pop_impl(Ring &ring)
+    ElementType *front_impl(Ring &ring) const
     {
-        auto &element = ring.elements[state.begin];
+        for (std::size_t position = state.begin, i = 0; i < Count; position = (position + 1) & Ring::COUNT_MASK, i++)
+        {
+            auto &element = ring.elements[position];
+            const auto element_state = element.state.load(std::memory_order_acquire);
+            if (element_state == Private::ElementState::READY_FOR_POP)
+                return element.value_ptr;
+            if (element_state != Private::ElementState::SKIPPED)
+                break;
+        }
+        return nullptr;
+    }
 
-        if (element.state.load(std::memory_order_acquire) == Private::ElementState::READY_FOR_POP)
+    template <typename Ring>
+    OptionalType<ElementType> pop_impl(Ring &ring)
+    {
+        while (true)
         {
-            OptionalType<ElementType> result{std::move(*element.value_ptr)};
-            element.value_ptr->~ElementType();
+            auto &element = ring.elements[state.begin];
+            const auto element_state = element.state.load(std::memory_order_acquire);
+
+            if (element_state == Private::ElementState::READY_FOR_POP)
+            {
+                Private::prefetch_element_for_pop<Configuration>(ring, state.begin);
+                OptionalType<ElementType> result{std::move(*element.value_ptr)};
+                element.value_ptr->~ElementType();
 
-            element.state.store(Private::ElementState::READY_FOR_PUSH, std::memory_order_release);
-            ring.notify_pop(ring);
+                element.state.store(Private::ElementState::READY_FOR_PUSH, std::memory_order_release);
+                ring.notify_pop(ring);
 
-            state.begin = (state.begin + 1) & Ring::COUNT_MASK;
-            return result;
+                state.begin = (state.begin + 1) & Ring::COUNT_MASK;
+                return result;
+            }
+            else if (element_state == Private::ElementState::SKIPPED) // A push into this slot threw, it holds nothing.
+            {
+                element.state.store(Private::ElementState::READY_FOR_PUSH, std::memory_order_release);
+                ring.notify_pop(ring);
+
+                state.begin = (state.begin + 1) & Ring::COUNT_MASK;
+            }
+            else
+                return OptionalType<ElementType>{};
         }
-        else
-            return OptionalType<ElementType>{};
     }
 };
 
+template <typename ElementType, std::size_t Count>
+using SingleConsumer = BasicSingleConsumer<ElementType, Count, DefaultPolicyConfiguration>;
+
 } // namespace WaitFreeRingBufferUtilities
 } // namespace Iyp
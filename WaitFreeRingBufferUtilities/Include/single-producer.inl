@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Iyp/WaitFreeRingBufferUtilities/optional-type.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/policy-configuration.inl"
 #include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
 
 #include <utility>
@@ -11,8 +12,8 @@ namespace Iyp
 {
 namespace WaitFreeRingBufferUtilities
 {
-template <typename ElementType, std::size_t Count>
-class SingleProducer
+template <typename ElementType, std::size_t Count, typename Configuration>
+class BasicSingleProducer
 {
     struct State
     {
@@ -34,7 +35,9 @@ public:
 
         if (element.state.load(std::memory_order_acquire) == Private::ElementState::READY_FOR_PUSH)
         {
-            element.value_ptr = new (&element.storage) ElementType(std::forward<Args>(args)...);
+            Private::prefetch_element_for_push<Configuration>(ring, state.end);
+            // Nothing is claimed before the element is built, so a throwing constructor leaves the ring as it was.
+            element.value_ptr = Private::construct_element<Configuration, ElementType>(element.storage, std::forward<Args>(args)...);
 
             element.state.store(Private::ElementState::READY_FOR_POP, std::memory_order_release);
             ring.notify_push(ring);
@@ -47,5 +50,8 @@ public:
     }
 };
 
+template <typename ElementType, std::size_t Count>
+using SingleProducer = BasicSingleProducer<ElementType, Count, DefaultPolicyConfiguration>;
+
 } // namespace WaitFreeRingBufferUtilities
 } // namespace Iyp
@@ -0,0 +1,379 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/ring-buffer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/cache-aligned-and-padded-object.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/details/cpu-relax.inl"
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+enum class TraceEventKind : std::uint8_t
+{
+    PUSH,
+    POP,
+};
+
+struct TraceEvent
+{
+    std::uint64_t timestamp_ns; // Since the ring was constructed.
+    std::uint32_t thread_index; // Small per-thread number, in the order threads first touched a traced ring.
+    TraceEventKind kind;
+};
+
+struct TraceHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t element_size;
+    std::uint64_t event_count;
+    std::uint64_t dropped_event_count;
+};
+
+namespace Private
+{
+using TraceClock = std::chrono::steady_clock;
+
+static constexpr char TRACE_MAGIC[8] = {'R', 'I', 'N', 'G', 'T', 'R', 'C', '\0'};
+
+enum : std::uint32_t
+{
+    TRACE_VERSION = 1,
+};
+
+inline std::uint32_t current_trace_thread_index()
+{
+    static std::atomic<std::uint32_t> next_thread_index{0};
+    thread_local const std::uint32_t thread_index = next_thread_index.fetch_add(1, std::memory_order_relaxed);
+    return thread_index;
+}
+
+inline std::uint64_t next_trace_recorder_id()
+{
+    static std::atomic<std::uint64_t> next_recorder_id{0};
+    return next_recorder_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Preallocated event log split in chunks. Each thread fills a chunk of its own and only claims the next one from the shared log once
+// it is full, so a record costs a clock read and a few thread local writes. Events that do not fit are counted and dropped.
+template <std::size_t EventCapacity>
+class TraceRecorder
+{
+    enum : std::size_t
+    {
+        CHUNK_SIZE = EventCapacity < 1024 ? EventCapacity : 1024,
+        CHUNK_COUNT = EventCapacity / CHUNK_SIZE,
+        MAX_THREAD_COUNT = 64, // Threads past it are not traced, only counted as dropping their events.
+    };
+
+    struct ThreadLog
+    {
+        std::atomic<std::uint32_t> thread_index;
+        std::size_t chunk_index;
+        std::size_t event_count{CHUNK_SIZE}; // Starts full so that the first record claims a chunk.
+        std::size_t dropped_event_count{0};
+    };
+
+    const std::uint64_t id{next_trace_recorder_id()};
+    const TraceClock::time_point start_time{TraceClock::now()};
+    const std::unique_ptr<TraceEvent[]> events{new TraceEvent[CHUNK_COUNT * CHUNK_SIZE]};
+    const std::unique_ptr<std::size_t[]> chunk_event_counts{new std::size_t[CHUNK_COUNT]()};
+    std::array<Details::CacheAlignedAndPaddedObject<ThreadLog>, MAX_THREAD_COUNT> thread_logs;
+    Details::CacheAlignedAndPaddedObject<std::atomic_size_t> thread_log_count{std::size_t(0)};
+    Details::CacheAlignedAndPaddedObject<std::atomic_size_t> next_chunk_index{std::size_t(0)};
+    Details::CacheAlignedAndPaddedObject<std::atomic_size_t> untraced_event_count{std::size_t(0)};
+
+    // The log of the calling thread, remembered per thread for the last recorder it used. Null if MAX_THREAD_COUNT threads have one.
+    ThreadLog *find_thread_log()
+    {
+        struct CachedThreadLog
+        {
+            std::uint64_t recorder_id;
+            ThreadLog *thread_log;
+        };
+        thread_local CachedThreadLog cached{std::numeric_limits<std::uint64_t>::max(), nullptr};
+        if (cached.recorder_id == id)
+            return cached.thread_log;
+
+        const std::uint32_t thread_index = current_trace_thread_index();
+        const std::size_t claimed_count = std::min<std::size_t>(thread_log_count.load(std::memory_order_acquire), MAX_THREAD_COUNT);
+        ThreadLog *thread_log = nullptr;
+        for (std::size_t i = 0; i < claimed_count && !thread_log; i++)
+            if (thread_logs[i].thread_index.load(std::memory_order_relaxed) == thread_index)
+                thread_log = &thread_logs[i];
+
+        if (!thread_log)
+        {
+            const std::size_t log_index = thread_log_count.fetch_add(1, std::memory_order_relaxed);
+            if (log_index >= MAX_THREAD_COUNT)
+                return nullptr;
+            thread_log = &thread_logs[log_index];
+            thread_log->thread_index.store(thread_index, std::memory_order_relaxed);
+        }
+
+        cached = CachedThreadLog{id, thread_log};
+        return thread_log;
+    }
+
+public:
+    TraceRecorder()
+    {
+        for (ThreadLog &thread_log : thread_logs)
+            thread_log.thread_index.store(std::numeric_limits<std::uint32_t>::max(), std::memory_order_relaxed);
+    }
+
+    void record(const TraceEventKind kind)
+    {
+        const auto timestamp = TraceClock::now();
+        ThreadLog *const thread_log = find_thread_log();
+        if (!thread_log)
+        {
+            untraced_event_count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        if (thread_log->event_count == CHUNK_SIZE)
+        {
+            const std::size_t chunk_index = next_chunk_index.load(std::memory_order_relaxed) < CHUNK_COUNT
+                                                ? next_chunk_index.fetch_add(1, std::memory_order_relaxed)
+                                                : std::size_t(CHUNK_COUNT);
+            if (chunk_index >= CHUNK_COUNT)
+            {
+                thread_log->dropped_event_count++;
+                return;
+            }
+            thread_log->chunk_index = chunk_index;
+            thread_log->event_count = 0;
+        }
+
+        auto &event = events[thread_log->chunk_index * CHUNK_SIZE + thread_log->event_count];
+        event.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp - start_time).count();
+        event.thread_index = thread_log->thread_index.load(std::memory_order_relaxed);
+        event.kind = kind;
+        chunk_event_counts[thread_log->chunk_index] = ++thread_log->event_count;
+    }
+
+    // Should only be called once the threads using the ring are done with it.
+    bool write(std::FILE *const file, const std::size_t element_size) const
+    {
+        const std::size_t chunk_count = std::min<std::size_t>(next_chunk_index.load(std::memory_order_acquire), CHUNK_COUNT);
+        std::vector<TraceEvent> sorted_events;
+        for (std::size_t chunk_index = 0; chunk_index < chunk_count; chunk_index++)
+            sorted_events.insert(sorted_events.end(), events.get() + chunk_index * CHUNK_SIZE,
+                                 events.get() + chunk_index * CHUNK_SIZE + chunk_event_counts[chunk_index]);
+
+        std::size_t dropped_event_count = untraced_event_count.load(std::memory_order_relaxed);
+        for (const ThreadLog &thread_log : thread_logs)
+            dropped_event_count += thread_log.dropped_event_count;
+
+        // Every thread logs in order, the chunks of different threads are merged back into time order here.
+        std::stable_sort(sorted_events.begin(), sorted_events.end(), [](const TraceEvent &a, const TraceEvent &b) {
+            return a.timestamp_ns < b.timestamp_ns;
+        });
+
+        TraceHeader header;
+        std::memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+        header.version = TRACE_VERSION;
+        header.element_size = static_cast<std::uint32_t>(element_size);
+        header.event_count = sorted_events.size();
+        header.dropped_event_count = dropped_event_count;
+
+        return std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+               std::fwrite(sorted_events.data(), sizeof(TraceEvent), sorted_events.size(), file) == sorted_events.size();
+    }
+};
+} // namespace Private
+
+// Wraps a consumer policy so that every successful push and pop of the ring is recorded with its time and thread. Pushes are
+// recorded from the consumer's notify_push hook, so the producer policy needs no change. That hook runs once the element is
+// published, so a pop can be timestamped slightly before the push of its element; replay_trace retries such a pop until it lands.
+// Usage: RingBuffer<MultiProducer, TracingConsumer<SingleConsumer>::Policy, ElementType, Count>, or TracingRingBuffer below.
+template <template <typename, std::size_t> class Consumer, std::size_t EventCapacity = (1 << 20)>
+struct TracingConsumer
+{
+    template <typename ElementType, std::size_t Count>
+    class Policy : public Consumer<ElementType, Count>
+    {
+        Private::TraceRecorder<EventCapacity> recorder;
+
+    public:
+        template <typename Ring>
+        void notify_push(Ring &ring)
+        {
+            Consumer<ElementType, Count>::notify_push(ring);
+            recorder.record(TraceEventKind::PUSH);
+        }
+
+        template <typename Ring>
+        OptionalType<ElementType> pop_impl(Ring &ring)
+        {
+            auto result = Consumer<ElementType, Count>::pop_impl(ring);
+            if (result)
+                recorder.record(TraceEventKind::POP);
+            return result;
+        }
+
+        bool write_trace(std::FILE *const file) const
+        {
+            return recorder.write(file, sizeof(ElementType));
+        }
+    };
+};
+
+template <template <typename, std::size_t> class Producer,
+          template <typename, std::size_t> class Consumer,
+          typename ElementType, std::size_t Count, std::size_t EventCapacity = (1 << 20)>
+class TracingRingBuffer : Private::RingBufferTypeConstructor<Producer, TracingConsumer<Consumer, EventCapacity>::template Policy, ElementType, Count>
+{
+    using Parrent = Private::RingBufferTypeConstructor<Producer, TracingConsumer<Consumer, EventCapacity>::template Policy, ElementType, Count>;
+
+public:
+    using Parrent::push;
+    using Parrent::pop;
+    using Parrent::write_trace;
+};
+
+// Returns false if the file does not hold a complete trace.
+inline bool read_trace(std::FILE *const file, TraceHeader &header, std::vector<TraceEvent> &events)
+{
+    if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+        std::memcmp(header.magic, Private::TRACE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != Private::TRACE_VERSION)
+        return false;
+
+    events.resize(static_cast<std::size_t>(header.event_count));
+    return std::fread(events.data(), sizeof(TraceEvent), events.size(), file) == events.size();
+}
+
+struct TraceReplayResult
+{
+    std::chrono::nanoseconds duration;
+    std::chrono::nanoseconds max_lateness;    // How far behind its scaled timestamp an operation was issued, at worst.
+    std::size_t push_count;
+    std::size_t pop_count;
+    std::size_t failed_push_attempt_count;    // Pushes retried because the ring was full.
+    std::size_t failed_pop_attempt_count;     // Pops retried because the ring was empty.
+    std::size_t abandoned_count;              // Operations given up because the other side had finished.
+};
+
+// Re-issues a trace against a ring, with one thread per traced thread. Each operation is issued at its timestamp divided by
+// rate_scale, so 2.0 replays twice as fast and 0.0 replays back to back. Pushes and pops are retried until they succeed, as they
+// did when the trace was taken; once every thread of one side is done, the other side gives up instead. Pushed elements are built
+// from the index of their event, so ElementType should be constructible from a std::size_t.
+template <typename Ring>
+TraceReplayResult replay_trace(Ring &ring, const std::vector<TraceEvent> &events, const double rate_scale = 1.0)
+{
+    struct ThreadResult
+    {
+        std::uint64_t max_lateness_ns{0};
+        std::size_t push_count{0};
+        std::size_t pop_count{0};
+        std::size_t failed_push_attempt_count{0};
+        std::size_t failed_pop_attempt_count{0};
+        std::size_t abandoned_count{0};
+    };
+
+    std::uint32_t thread_count = 0;
+    for (const auto &event : events)
+        thread_count = std::max(thread_count, event.thread_index + 1);
+
+    std::vector<std::vector<std::size_t>> thread_event_indices(thread_count);
+    std::vector<bool> is_pushing_thread(thread_count, false);
+    std::vector<bool> is_popping_thread(thread_count, false);
+    for (std::size_t i = 0; i < events.size(); i++)
+    {
+        thread_event_indices[events[i].thread_index].push_back(i);
+        (events[i].kind == TraceEventKind::PUSH ? is_pushing_thread : is_popping_thread)[events[i].thread_index] = true;
+    }
+
+    std::atomic_size_t running_pusher_count{static_cast<std::size_t>(std::count(is_pushing_thread.begin(), is_pushing_thread.end(), true))};
+    std::atomic_size_t running_popper_count{static_cast<std::size_t>(std::count(is_popping_thread.begin(), is_popping_thread.end(), true))};
+    std::vector<ThreadResult> thread_results(thread_count);
+
+    const auto start_time = Private::TraceClock::now() + std::chrono::milliseconds(1);
+    std::vector<std::thread> threads;
+    for (std::uint32_t thread_index = 0; thread_index < thread_count; thread_index++)
+    {
+        if (thread_event_indices[thread_index].empty())
+            continue; // Thread indices are numbered per process, other rings may have used some of them.
+
+        threads.emplace_back([&, thread_index]() {
+            ThreadResult result;
+
+            for (const std::size_t event_index : thread_event_indices[thread_index])
+            {
+                const auto &event = events[event_index];
+                if (rate_scale > 0.0)
+                {
+                    const auto target_time = start_time + std::chrono::nanoseconds(static_cast<std::uint64_t>(event.timestamp_ns / rate_scale));
+                    if (target_time - Private::TraceClock::now() > std::chrono::microseconds(200))
+                        std::this_thread::sleep_until(target_time - std::chrono::microseconds(100));
+                    while (Private::TraceClock::now() < target_time)
+                        Details::cpu_relax();
+
+                    const std::uint64_t lateness_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Private::TraceClock::now() - target_time).count();
+                    result.max_lateness_ns = std::max(result.max_lateness_ns, lateness_ns);
+                }
+
+                const bool is_push = event.kind == TraceEventKind::PUSH;
+                bool is_other_side_done = false;
+                while (true)
+                {
+                    if (is_push ? ring.push(event_index) : static_cast<bool>(ring.pop()))
+                    {
+                        (is_push ? result.push_count : result.pop_count)++;
+                        break;
+                    }
+                    if (is_other_side_done)
+                    {
+                        result.abandoned_count++;
+                        break;
+                    }
+                    // One last attempt once the other side is seen done, it may have finished right after the failed one.
+                    is_other_side_done = !(is_push ? running_popper_count : running_pusher_count).load(std::memory_order_acquire);
+                    (is_push ? result.failed_push_attempt_count : result.failed_pop_attempt_count)++;
+                    Details::cpu_relax();
+                }
+            }
+
+            thread_results[thread_index] = result;
+
+            if (is_pushing_thread[thread_index])
+                running_pusher_count.fetch_sub(1, std::memory_order_release);
+            if (is_popping_thread[thread_index])
+                running_popper_count.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    for (auto &thread : threads)
+        thread.join();
+
+    TraceReplayResult replay_result{std::chrono::duration_cast<std::chrono::nanoseconds>(Private::TraceClock::now() - start_time),
+                                    std::chrono::nanoseconds(0), 0, 0, 0, 0, 0};
+    for (const ThreadResult &result : thread_results)
+    {
+        replay_result.max_lateness = std::max(replay_result.max_lateness, std::chrono::nanoseconds(result.max_lateness_ns));
+        replay_result.push_count += result.push_count;
+        replay_result.pop_count += result.pop_count;
+        replay_result.failed_push_attempt_count += result.failed_push_attempt_count;
+        replay_result.failed_pop_attempt_count += result.failed_pop_attempt_count;
+        replay_result.abandoned_count += result.abandoned_count;
+    }
+    return replay_result;
+}
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp
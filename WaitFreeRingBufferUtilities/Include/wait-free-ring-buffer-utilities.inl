@@ -6,3 +6,11 @@
 #include "Iyp/WaitFreeRingBufferUtilities/multi-consumer.inl"
 #include "Iyp/WaitFreeRingBufferUtilities/single-producer.inl"
 #include "Iyp/WaitFreeRingBufferUtilities/single-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/ordered-multi-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/ordered-multi-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/adaptive-producer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/adaptive-consumer.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/wait-strategy.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/policy-configuration.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/configured-policies.inl"
+#include "Iyp/WaitFreeRingBufferUtilities/handles.inl"
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Iyp/WaitFreeRingBufferUtilities/details/cpu-relax.inl"
+
+#include <utility>
+#include <cstddef>
+#include <chrono>
+#include <thread>
+#include <type_traits>
+
+namespace Iyp
+{
+namespace WaitFreeRingBufferUtilities
+{
+// A wait strategy is constructed at the start of every retry loop and its wait() is called after each failed attempt.
+
+struct BusySpinWait
+{
+    void wait()
+    {
+    }
+};
+
+struct PauseWait
+{
+    void wait()
+    {
+        Details::cpu_relax();
+    }
+};
+
+template <std::size_t MaxPauseCount = 1024>
+class ExponentialBackoffWait
+{
+    static_assert(MaxPauseCount > 0, "MaxPauseCount should be positive.");
+
+    std::size_t pause_count{1};
+
+public:
+    void wait()
+    {
+        for (std::size_t i = 0; i < pause_count; i++)
+            Details::cpu_relax();
+
+        if (pause_count < MaxPauseCount)
+            pause_count = (pause_count * 2 < MaxPauseCount) ? pause_count * 2 : MaxPauseCount;
+    }
+};
+
+struct YieldWait
+{
+    void wait()
+    {
+        std::this_thread::yield();
+    }
+};
+
+template <std::size_t SleepMicroseconds = 50>
+struct SleepWait
+{
+    void wait()
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(SleepMicroseconds));
+    }
+};
+
+// Arguments are only forwarded to the element constructor by the push that succeeds, so retrying with them is safe.
+template <typename WaitStrategy = PauseWait, typename Ring, typename... Args>
+void push_wait(Ring &ring, Args &&...args)
+{
+    WaitStrategy wait_strategy;
+    while (!ring.push(std::forward<Args>(args)...))
+        wait_strategy.wait();
+}
+
+template <typename WaitStrategy = PauseWait, typename Ring>
+auto pop_wait(Ring &ring) -> typename std::decay<decltype(*ring.pop())>::type
+{
+    WaitStrategy wait_strategy;
+    while (true)
+    {
+        auto result = ring.pop();
+        if (result)
+            return std::move(*result);
+        wait_strategy.wait();
+    }
+}
+
+} // namespace WaitFreeRingBufferUtilities
+} // namespace Iyp